@@ -12,9 +12,9 @@ COL_DATA_DESC = "data_description"
 COL_DATA_DISTR = "data_distribution"
 COL_DATA_ORDER = "data_ordering"
 COL_DATA_SIZE = "cases.data_size"
-COL_DURATION = "cases.executions.duration_ns"
+COL_DURATION = "cases.executions.measurements.duration_ns"
 COL_INDEX_NAME = "cases.index_name"
-COL_INDEX_SIZE = "cases.executions.index_size_bytes"
+COL_INDEX_SIZE = "cases.executions.measurements.index_size_bytes"
 COL_KEY_TYPE = "cases.key_type"
 COL_VAL_TYPE = "cases.value_type"
 
@@ -0,0 +1,55 @@
+#!/usr/bin/env python3
+
+import random
+import struct
+import sys
+
+random.seed(1337)
+
+
+# Writes the strings in the binary string format of the benchmark (see src/data/mapped_string_file.hpp): the string
+# count as uint64 followed by the strings, each as its length (uint32) followed by its UTF-8 bytes.
+def save_strings(strings, file_name):
+    with open(file_name, "wb") as file:
+        file.write(struct.pack("Q", len(strings)))
+        for string in strings:
+            encoded = string.encode("utf-8")
+            file.write(struct.pack("I", len(encoded)))
+            file.write(encoded)
+    print("File was saved: " + file_name)
+
+
+# generates the data file with the unique keys of the key file (one key per line) in their order, and equality and
+# range lookups on them. A range lookup spans range_size consecutive keys in lexicographic order.
+def generate_string_data(key_file, out_file_prefix, equality_lookup_count, range_lookup_count, range_size):
+    with open(key_file, encoding="utf-8") as file:
+        keys = list(dict.fromkeys(line.rstrip("\n") for line in file if line.rstrip("\n")))
+    if any("\0" in key for key in keys):
+        exit("The keys must not contain 0 bytes.")
+    save_strings(keys, out_file_prefix + "_string")
+
+    save_strings(random.choices(keys, k=equality_lookup_count), out_file_prefix + "_string_equality_lookups")
+
+    sorted_keys = sorted(keys, key=lambda key: key.encode("utf-8"))
+    range_lookups = []
+    for _ in range(range_lookup_count):
+        lower_bound_index = random.randrange(len(sorted_keys))
+        upper_bound_index = min(lower_bound_index + range_size - 1, len(sorted_keys) - 1)
+        range_lookups.append(sorted_keys[lower_bound_index])
+        range_lookups.append(sorted_keys[upper_bound_index])
+    save_strings(range_lookups, out_file_prefix + "_string_range_lookups")
+
+
+def main():
+    if len(sys.argv) != 6:
+        exit(
+            "Usage: "
+            + sys.argv[0]
+            + " <key file> <output file prefix> <equality lookup count> <range lookup count> <range size>"
+        )
+
+    generate_string_data(sys.argv[1], sys.argv[2], int(sys.argv[3]), int(sys.argv[4]), int(sys.argv[5]))
+
+
+if __name__ == "__main__":
+    main()
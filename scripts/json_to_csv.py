@@ -13,8 +13,8 @@ def main():
         jdata = json.load(json_file)
 
     df = json_to_dataframe(jdata)
-    df = df.drop(columns=["cases.executions"])
-    df.dropna(inplace=True)
+    # one row per measurement, the optional fields of the executions are empty if they were not recorded
+    df.dropna(subset=["cases.executions.measurements.duration_ns"], inplace=True)
     df.reset_index(drop=True, inplace=True)
     df.to_csv(sys.argv[2])
 
@@ -41,3 +41,15 @@ def json_to_dataframe(data_in):
         return rows
 
     return pd.DataFrame(flatten_json(data_in))
+
+
+def measurements_to_dataframe(data_in, columns):
+    """Returns the given columns of each measurement of a result file. Each execution of a case is an object whose
+    "measurements" array holds the measurements of the execution, next to optional fields like the throughput, thus,
+    the measurement columns are prefixed by "cases.executions.measurements". Rows without a measurement are
+    dropped."""
+    df = json_to_dataframe(data_in)
+    df = df[[column for column in columns if column in df.columns]]
+    df = df.dropna()
+    df.reset_index(drop=True, inplace=True)
+    return df
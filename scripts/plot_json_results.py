@@ -1,6 +1,6 @@
 #!/usr/bin/env python3
 
-from json_utils import json_to_dataframe
+from json_utils import measurements_to_dataframe
 import json
 import matplotlib.pyplot as plt
 import numpy as np
@@ -35,20 +35,13 @@ def main():
     with open(sys.argv[1]) as json_file:
         jdata = json.load(json_file)
 
-    df = json_to_dataframe(jdata)
-
     # columns
     c_case_name = "cases.case_name"
     c_index_name = "cases.index_name"
-    c_executions = "cases.executions"
-    c_iter = "configuration.iterations"
-    c_threads = "configuration.threads"
-    c_duration = "cases.executions.duration_ns"
-    c_index_size = "cases.executions.index_size_bytes"
+    c_duration = "cases.executions.measurements.duration_ns"
+    c_index_size = "cases.executions.measurements.index_size_bytes"
 
-    df = df.drop(columns=[c_executions, c_iter, c_threads])
-    df.dropna(inplace=True)
-    df.reset_index(drop=True, inplace=True)
+    df = measurements_to_dataframe(jdata, [c_case_name, c_index_name, c_duration, c_index_size])
     print(df.to_string())
     df_med = df.groupby([c_case_name, c_index_name], as_index=False).median()
     df_med.set_index(c_case_name, inplace=True)
@@ -1,6 +1,6 @@
 #!/usr/bin/env python3
 
-from json_utils import json_to_dataframe
+from json_utils import measurements_to_dataframe
 
 from matplotlib.cm import get_cmap
 import glob
@@ -49,14 +49,11 @@ competitors = [
 
 # columns
 c_case_name = "cases.case_name"
-c_duration = "cases.executions.duration_ns"
-c_executions = "cases.executions"
+c_duration = "cases.executions.measurements.duration_ns"
 c_index_name = "cases.index_name"
-c_index_size = "cases.executions.index_size_bytes"
-c_iter = "configuration.iterations"
+c_index_size = "cases.executions.measurements.index_size_bytes"
 c_key_type = "cases.key_type"
 c_data_size = "cases.data_size"
-c_threads = "configuration.threads"
 c_val_type = "cases.value_type"
 
 SUBPLOT_COL_SIZE = 4
@@ -70,10 +67,9 @@ MARKER_SIZE = 5
 
 
 def json_to_filtered_median_dataframe(jdata):
-    df = json_to_dataframe(jdata)
-    df = df.drop(columns=[c_executions, c_iter, c_threads])
-    df.dropna(inplace=True)
-    df.reset_index(drop=True, inplace=True)
+    df = measurements_to_dataframe(
+        jdata, [c_case_name, c_index_name, c_key_type, c_val_type, c_data_size, c_duration, c_index_size]
+    )
     df_med = df.groupby([c_case_name, c_index_name, c_key_type, c_val_type], as_index=False).median()
     df_med.set_index(c_case_name, inplace=True)
     df_med.replace(0, np.nan, inplace=True)
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <functional>
 #include <string>
 #include <vector>
@@ -9,6 +10,7 @@
 
 #include "data/column.hpp"
 #include "types.hpp"
+#include "utils/key_encoding.hpp"
 
 namespace imib {
 
@@ -17,14 +19,17 @@ namespace imib {
 // https://github.com/flode/ARTSynchronized/issues/1
 // tid 0 is not supported
 
+// The keys are encoded binary-comparable (see KeyEncoding), thus, the order of the tree matches the order of the keys
+// and neighboring keys share prefixes, which the ART compresses.
+template <typename Key>
+void set_art_key(const Key& key, ART::Key& art_key) {
+  art_key.setKeyLen(static_cast<uint32_t>(KeyEncoding::size(key)));
+  KeyEncoding::encode(key, &art_key[0]);
+}
+
 template <typename Key, typename Value>
 void load_key(TID tid, ART::Key& art_key) {
-  const Key& key = Column<Key, Value>::value_at(tid);
-  char char_key[sizeof(key)];
-  *reinterpret_cast<Key*>(char_key) = key;
-  // alternative:
-  // std::memcpy(char_key, &key, sizeof(key));
-  art_key.set(char_key, sizeof(char_key));
+  set_art_key(Column<Key, Value>::value_at(tid), art_key);
 }
 
 template <typename Key, typename Value>
@@ -51,6 +56,11 @@ class Art {
     }
   }
 
+  static bool supports_concurrent(const IndexOperationType operation_type) {
+    // range lookups are not supported at all, see range_lookup
+    return operation_type == IndexOperationType::EqualityLookup;
+  }
+
   Art() : _tree(load_key<Key, Value>) {
     // do nothing
   }
@@ -74,30 +84,32 @@ class Art {
 
   void erase(const Key& key, const Value& value) {
     ART::Key art_key;
-    char char_key[sizeof(key)];
-    *reinterpret_cast<Key*>(char_key) = key;
-    // alternative:
-    // std::memcpy(char_key, &key, sizeof(key));
-    art_key.set(char_key, sizeof(char_key));
+    set_art_key(key, art_key);
     _tree.remove(art_key, value);
   }
 
   std::vector<Value> equality_lookup(const Key& key) const {
+    auto result = std::vector<Value>{};
+    equality_lookup(key, result);
+    return result;
+  }
+
+  void equality_lookup(const Key& key, std::vector<Value>& result) const {
     ART::Key art_key;
-    char char_key[sizeof(key)];
-    *reinterpret_cast<Key*>(char_key) = key;
-    // alternative:
-    // std::memcpy(char_key, &key, sizeof(key));
-    art_key.set(char_key, sizeof(char_key));
+    set_art_key(key, art_key);
     const auto tid = _tree.lookup(art_key);
     if (tid > 0) {
-      return std::vector<Value>{tid};
+      result.emplace_back(tid);
     }
-    return std::vector<Value>{};
   }
 
   std::vector<Value> range_lookup(const Key& lower_bound_key, const Key& upper_bound_key) const {
-    // TODO(Marcel) implement, edit: range lookup is commented out in ARTSynchronized
+    // the range lookup of the unsynchronized tree is commented out in ARTSynchronized, see ArtReference for an ART
+    // with range lookups
+    throw std::logic_error("Not supported.");
+  }
+
+  void range_lookup(const Key& lower_bound_key, const Key& upper_bound_key, std::vector<Value>& result) const {
     throw std::logic_error("Not supported.");
   }
 
@@ -0,0 +1,129 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Key.h"
+#include "OptimisticLockCoupling/Tree.h"
+
+#include "competitors/art.hpp"
+#include "data/column.hpp"
+#include "types.hpp"
+
+namespace imib {
+
+// ART synchronized with optimistic lock coupling, see https://db.in.tum.de/~leis/papers/artsync.pdf
+// All supported operations can be executed concurrently. Each operation enters the tree's epoch-based memory
+// reclamation with a thread info. In contrast to the unsynchronized ART, it supports range lookups. As for the
+// unsynchronized ART, tid 0 is not supported.
+
+template <typename Key, typename Value>
+class ArtOlc {
+ public:
+  static bool supports_key_duplicates() { return false; }
+
+  static bool supports(const IndexOperationType operation_type) {
+    switch (operation_type) {
+      case IndexOperationType::BulkLoad:
+        return false;
+      case IndexOperationType::BulkInsert:
+        return false;
+      case IndexOperationType::BulkErase:
+        return false;
+      case IndexOperationType::InsertEntry:
+        return true;
+      case IndexOperationType::EraseEntry:
+        return true;
+      case IndexOperationType::EqualityLookup:
+        return true;
+      case IndexOperationType::RangeLookup:
+        return true;
+    }
+  }
+
+  static bool supports_concurrent(const IndexOperationType operation_type) { return supports(operation_type); }
+
+  ArtOlc() : _tree(load_key<Key, Value>) {
+    // do nothing
+  }
+
+  static const std::string name() { return "OLC ART"; }
+
+  static IndexType type() { return IndexType::ARTOLC; }
+
+  void bulk_load(const Data<Key, Value>& data) { throw std::logic_error("Not supported."); }
+
+  void bulk_insert(const Data<Key, Value>& data) { throw std::logic_error("Not supported."); }
+
+  void bulk_erase(const Data<Key, Value>& data) { throw std::logic_error("Not supported."); }
+
+  void insert(const Key& key, const Value& value) {
+    const auto& tid = value;
+    ART::Key art_key;
+    load_key<Key, Value>(tid, art_key);
+    auto thread_info = _tree.getThreadInfo();
+    _tree.insert(art_key, tid, thread_info);
+  }
+
+  void erase(const Key& key, const Value& value) {
+    ART::Key art_key;
+    set_art_key(key, art_key);
+    auto thread_info = _tree.getThreadInfo();
+    _tree.remove(art_key, value, thread_info);
+  }
+
+  std::vector<Value> equality_lookup(const Key& key) const {
+    auto result = std::vector<Value>{};
+    equality_lookup(key, result);
+    return result;
+  }
+
+  void equality_lookup(const Key& key, std::vector<Value>& result) const {
+    ART::Key art_key;
+    set_art_key(key, art_key);
+    auto thread_info = _tree.getThreadInfo();
+    const auto tid = _tree.lookup(art_key, thread_info);
+    if (tid > 0) {
+      result.emplace_back(tid);
+    }
+  }
+
+  std::vector<Value> range_lookup(const Key& lower_bound_key, const Key& upper_bound_key) const {
+    auto result = std::vector<Value>{};
+    range_lookup(lower_bound_key, upper_bound_key, result);
+    return result;
+  }
+
+  // The keys are encoded binary-comparable (see set_art_key), thus, the scan of the tree returns the keys in their
+  // order. The tree writes the tids to a buffer and returns the key to continue with if the buffer is full.
+  void range_lookup(const Key& lower_bound_key, const Key& upper_bound_key, std::vector<Value>& result) const {
+    ART::Key start_key;
+    set_art_key(lower_bound_key, start_key);
+    ART::Key end_key;
+    set_art_key(upper_bound_key, end_key);
+    ART::Key continue_key;
+    TID tids[RANGE_LOOKUP_BUFFER_SIZE];
+    auto thread_info = _tree.getThreadInfo();
+    auto more_results = true;
+    while (more_results) {
+      auto tid_count = size_t{0};
+      more_results =
+          _tree.lookupRange(start_key, end_key, continue_key, tids, RANGE_LOOKUP_BUFFER_SIZE, tid_count, thread_info);
+      result.insert(result.end(), tids, tids + tid_count);
+      if (more_results) {
+        start_key = std::move(continue_key);
+        continue_key = ART::Key{};
+      }
+    }
+  }
+
+ protected:
+  static constexpr size_t RANGE_LOOKUP_BUFFER_SIZE = 256;
+
+  // getThreadInfo() is not const, since it registers the calling thread at the tree's epoch manager
+  mutable ART_OLC::Tree _tree;
+};
+
+}  // namespace imib
@@ -0,0 +1,134 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "art.hpp"
+#include "types.hpp"
+
+namespace imib {
+
+// The unsynchronized ART with key duplicates. The ART stores one TID per key, thus, the tree stores the first TID of
+// each key, and the further TIDs of the key are chained in a posting list: _next_tids[tid] is the TID that follows tid
+// in the posting list of its key (0 at the end), and _last_tids[first TID] is the last TID of the posting list. Both
+// are indexed by the TID, like the Column that the ART loads its keys from, thus, a duplicate costs two values
+// instead of a tree leaf. The values are returned in the order they were inserted.
+template <typename Key, typename Value>
+class ArtPostingList {
+ public:
+  static bool supports_key_duplicates() { return true; }
+
+  static bool supports(const IndexOperationType operation_type) {
+    switch (operation_type) {
+      case IndexOperationType::BulkLoad:
+        return false;
+      case IndexOperationType::BulkInsert:
+        return false;
+      case IndexOperationType::BulkErase:
+        return false;
+      case IndexOperationType::InsertEntry:
+        return true;
+      case IndexOperationType::EraseEntry:
+        return true;
+      case IndexOperationType::EqualityLookup:
+        return true;
+      case IndexOperationType::RangeLookup:
+        return false;
+    }
+  }
+
+  static bool supports_concurrent(const IndexOperationType operation_type) {
+    return operation_type == IndexOperationType::EqualityLookup || operation_type == IndexOperationType::RangeLookup;
+  }
+
+  ArtPostingList() : _tree(load_key<Key, Value>) {
+    // do nothing
+  }
+
+  static const std::string name() { return "Unsync ART Posting List"; }
+
+  static IndexType type() { return IndexType::ARTPostingList; }
+
+  void bulk_load(const Data<Key, Value>& data) { throw std::logic_error("Not supported."); }
+
+  void bulk_insert(const Data<Key, Value>& data) { throw std::logic_error("Not supported."); }
+
+  void bulk_erase(const Data<Key, Value>& data) { throw std::logic_error("Not supported."); }
+
+  void insert(const Key& key, const Value& value) {
+    const auto& tid = value;
+    if (tid >= _next_tids.size()) {
+      _next_tids.resize(tid + 1);
+      _last_tids.resize(tid + 1);
+    }
+    ART::Key art_key;
+    set_art_key(key, art_key);
+    const auto first_tid = static_cast<Value>(_tree.lookup(art_key));
+    if (first_tid == 0) {
+      _tree.insert(art_key, tid);
+      _last_tids[tid] = tid;
+    } else {
+      _next_tids[_last_tids[first_tid]] = tid;
+      _last_tids[first_tid] = tid;
+    }
+  }
+
+  void erase(const Key& key, const Value& value) {
+    ART::Key art_key;
+    set_art_key(key, art_key);
+    const auto first_tid = static_cast<Value>(_tree.lookup(art_key));
+    if (first_tid == 0) {
+      return;
+    }
+    if (first_tid == value) {
+      // the next TID becomes the first TID of the posting list
+      const auto next_tid = _next_tids[first_tid];
+      _tree.remove(art_key, first_tid);
+      if (next_tid != 0) {
+        _tree.insert(art_key, next_tid);
+        _last_tids[next_tid] = _last_tids[first_tid];
+      }
+      _next_tids[first_tid] = 0;
+      return;
+    }
+    for (auto tid = first_tid; _next_tids[tid] != 0; tid = _next_tids[tid]) {
+      if (_next_tids[tid] == value) {
+        _next_tids[tid] = _next_tids[value];
+        _next_tids[value] = 0;
+        if (_last_tids[first_tid] == value) {
+          _last_tids[first_tid] = tid;
+        }
+        return;
+      }
+    }
+  }
+
+  std::vector<Value> equality_lookup(const Key& key) const {
+    auto result = std::vector<Value>{};
+    equality_lookup(key, result);
+    return result;
+  }
+
+  void equality_lookup(const Key& key, std::vector<Value>& result) const {
+    ART::Key art_key;
+    set_art_key(key, art_key);
+    for (auto tid = static_cast<Value>(_tree.lookup(art_key)); tid != 0; tid = _next_tids[tid]) {
+      result.emplace_back(tid);
+    }
+  }
+
+  std::vector<Value> range_lookup(const Key& lower_bound_key, const Key& upper_bound_key) const {
+    throw std::logic_error("Not supported.");
+  }
+
+  void range_lookup(const Key& lower_bound_key, const Key& upper_bound_key, std::vector<Value>& result) const {
+    throw std::logic_error("Not supported.");
+  }
+
+ protected:
+  ART_unsynchronized::Tree _tree;
+  std::vector<Value> _next_tids;
+  std::vector<Value> _last_tids;
+};
+
+}  // namespace imib
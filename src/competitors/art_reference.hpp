@@ -0,0 +1,774 @@
+#pragma once
+
+#include <emmintrin.h>  // x86 SSE intrinsics
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "data/column.hpp"
+#include "types.hpp"
+#include "utils/key_encoding.hpp"
+
+// supports: only unique keys, no support for key duplicates
+
+namespace imib {
+
+// Nodes of the reference implementation of the ART by Viktor Leis (see third_party/ART/ART.cpp), which is described in
+// "The Adaptive Radix Tree: ARTful Indexing for Main-Memory Databases" (ICDE 2013).
+namespace art_reference {
+
+constexpr int8_t NODE_TYPE_4 = 0;
+constexpr int8_t NODE_TYPE_16 = 1;
+constexpr int8_t NODE_TYPE_48 = 2;
+constexpr int8_t NODE_TYPE_256 = 3;
+
+// The maximum prefix length for compressed paths stored in the header. If the path is longer, it is loaded from the
+// column on demand.
+constexpr uint32_t MAX_PREFIX_LENGTH = 9;
+
+// shared header of all inner nodes
+struct Node {
+  uint32_t prefix_length = 0;
+  uint16_t count = 0;
+  int8_t type;
+  uint8_t prefix[MAX_PREFIX_LENGTH] = {};
+
+  explicit Node(const int8_t p_type) : type(p_type) {}
+};
+
+struct Node4 : Node {
+  uint8_t key[4] = {};
+  Node* child[4] = {};
+
+  Node4() : Node(NODE_TYPE_4) {}
+};
+
+// the keys are stored with a flipped sign bit, which enables signed SSE comparisons of unsigned key bytes
+struct Node16 : Node {
+  uint8_t key[16] = {};
+  Node* child[16] = {};
+
+  Node16() : Node(NODE_TYPE_16) {}
+};
+
+constexpr uint8_t EMPTY_MARKER = 48;
+
+struct Node48 : Node {
+  uint8_t child_index[256];
+  Node* child[48] = {};
+
+  Node48() : Node(NODE_TYPE_48) { std::memset(child_index, EMPTY_MARKER, sizeof(child_index)); }
+};
+
+struct Node256 : Node {
+  Node* child[256] = {};
+
+  Node256() : Node(NODE_TYPE_256) {}
+};
+
+// leaves are tagged tids (pointer tagging)
+inline Node* make_leaf(const uintptr_t tid) { return reinterpret_cast<Node*>((tid << 1) | 1); }
+
+inline uintptr_t leaf_value(const Node* node) { return reinterpret_cast<uintptr_t>(node) >> 1; }
+
+inline bool is_leaf(const Node* node) { return reinterpret_cast<uintptr_t>(node) & 1; }
+
+inline uint8_t flip_sign(const uint8_t key_byte) { return static_cast<uint8_t>(key_byte ^ 128); }
+
+// loads the 16 key bytes of a Node16, memcpy avoids casting the byte array to the stricter aligned vector type
+inline __m128i load_keys(const uint8_t keys[16]) {
+  __m128i result;
+  std::memcpy(&result, keys, sizeof(result));
+  return result;
+}
+
+}  // namespace art_reference
+
+// Header-only port of the reference ART with path compression and lazy expansion. In contrast to the ART of
+// ARTSynchronized, it supports range lookups by an ordered traversal. The keys are encoded binary-comparable (see
+// KeyEncoding), thus, the order of the tree matches the order of the keys. The keys have a fixed length, i.e., string
+// keys are not supported. As for the other ARTs, the keys are loaded from the Column and tid 0 is not supported.
+template <typename Key, typename Value>
+class ArtReference {
+  using Node = art_reference::Node;
+  using Node4 = art_reference::Node4;
+  using Node16 = art_reference::Node16;
+  using Node48 = art_reference::Node48;
+  using Node256 = art_reference::Node256;
+
+  static constexpr uint32_t KEY_LENGTH = sizeof(Key);
+
+ public:
+  static bool supports_key_duplicates() { return false; }
+
+  static bool supports(const IndexOperationType operation_type) {
+    switch (operation_type) {
+      case IndexOperationType::BulkLoad:
+        return false;
+      case IndexOperationType::BulkInsert:
+        return false;
+      case IndexOperationType::BulkErase:
+        return false;
+      case IndexOperationType::InsertEntry:
+        return true;
+      case IndexOperationType::EraseEntry:
+        return true;
+      case IndexOperationType::EqualityLookup:
+        return true;
+      case IndexOperationType::RangeLookup:
+        return true;
+    }
+  }
+
+  static bool supports_concurrent(const IndexOperationType operation_type) {
+    return operation_type == IndexOperationType::EqualityLookup || operation_type == IndexOperationType::RangeLookup;
+  }
+
+  ArtReference() = default;
+
+  ArtReference(const ArtReference&) = delete;
+
+  ArtReference& operator=(const ArtReference&) = delete;
+
+  ~ArtReference() { _destroy(_root); }
+
+  static const std::string name() { return "Ref ART"; }
+
+  static IndexType type() { return IndexType::ARTReference; }
+
+  void bulk_load(const Data<Key, Value>& data) { throw std::logic_error("Not supported."); }
+
+  void bulk_insert(const Data<Key, Value>& data) { throw std::logic_error("Not supported."); }
+
+  void bulk_erase(const Data<Key, Value>& data) { throw std::logic_error("Not supported."); }
+
+  void insert(const Key& key, const Value& value) {
+    uint8_t key_bytes[KEY_LENGTH];
+    _encode(key, key_bytes);
+    _insert(_root, &_root, key_bytes, 0, value);
+  }
+
+  void erase(const Key& key, const Value& value) {
+    uint8_t key_bytes[KEY_LENGTH];
+    _encode(key, key_bytes);
+    _erase(_root, &_root, key_bytes, 0);
+  }
+
+  std::vector<Value> equality_lookup(const Key& key) const {
+    auto result = std::vector<Value>{};
+    equality_lookup(key, result);
+    return result;
+  }
+
+  void equality_lookup(const Key& key, std::vector<Value>& result) const {
+    uint8_t key_bytes[KEY_LENGTH];
+    _encode(key, key_bytes);
+    const auto* leaf = _lookup(_root, key_bytes);
+    if (leaf != nullptr) {
+      result.emplace_back(static_cast<Value>(art_reference::leaf_value(leaf)));
+    }
+  }
+
+  std::vector<Value> range_lookup(const Key& lower_bound_key, const Key& upper_bound_key) const {
+    auto result = std::vector<Value>{};
+    range_lookup(lower_bound_key, upper_bound_key, result);
+    return result;
+  }
+
+  void range_lookup(const Key& lower_bound_key, const Key& upper_bound_key, std::vector<Value>& result) const {
+    uint8_t lower_bound[KEY_LENGTH];
+    uint8_t upper_bound[KEY_LENGTH];
+    _encode(lower_bound_key, lower_bound);
+    _encode(upper_bound_key, upper_bound);
+    _range_lookup(_root, 0, lower_bound, upper_bound, true, true, result);
+  }
+
+ protected:
+  static void _encode(const Key& key, uint8_t key_bytes[]) { KeyEncoding::encode(key, key_bytes); }
+
+  static void _load_key(const uintptr_t tid, uint8_t key_bytes[]) {
+    _encode(Column<Key, Value>::value_at(tid), key_bytes);
+  }
+
+  static void _destroy(Node* node) {
+    if (node == nullptr || art_reference::is_leaf(node)) {
+      return;
+    }
+    switch (node->type) {
+      case art_reference::NODE_TYPE_4: {
+        auto* typed_node = static_cast<Node4*>(node);
+        for (uint32_t index = 0; index < typed_node->count; ++index) {
+          _destroy(typed_node->child[index]);
+        }
+        delete typed_node;
+        return;
+      }
+      case art_reference::NODE_TYPE_16: {
+        auto* typed_node = static_cast<Node16*>(node);
+        for (uint32_t index = 0; index < typed_node->count; ++index) {
+          _destroy(typed_node->child[index]);
+        }
+        delete typed_node;
+        return;
+      }
+      case art_reference::NODE_TYPE_48: {
+        auto* typed_node = static_cast<Node48*>(node);
+        for (auto* child : typed_node->child) {
+          _destroy(child);
+        }
+        delete typed_node;
+        return;
+      }
+      case art_reference::NODE_TYPE_256: {
+        auto* typed_node = static_cast<Node256*>(node);
+        for (auto* child : typed_node->child) {
+          _destroy(child);
+        }
+        delete typed_node;
+        return;
+      }
+    }
+  }
+
+  // returns the slot of the child for the key byte, or a slot containing nullptr if there is no such child
+  static Node** _find_child(Node* node, const uint8_t key_byte) {
+    static Node* null_node = nullptr;
+    switch (node->type) {
+      case art_reference::NODE_TYPE_4: {
+        auto* typed_node = static_cast<Node4*>(node);
+        for (uint32_t index = 0; index < typed_node->count; ++index) {
+          if (typed_node->key[index] == key_byte) {
+            return &typed_node->child[index];
+          }
+        }
+        return &null_node;
+      }
+      case art_reference::NODE_TYPE_16: {
+        auto* typed_node = static_cast<Node16*>(node);
+        const auto comparison = _mm_cmpeq_epi8(_mm_set1_epi8(static_cast<char>(art_reference::flip_sign(key_byte))),
+                                               art_reference::load_keys(typed_node->key));
+        const auto bitfield =
+            static_cast<uint32_t>(_mm_movemask_epi8(comparison)) & ((1u << typed_node->count) - 1);
+        if (bitfield != 0) {
+          return &typed_node->child[__builtin_ctz(bitfield)];
+        }
+        return &null_node;
+      }
+      case art_reference::NODE_TYPE_48: {
+        auto* typed_node = static_cast<Node48*>(node);
+        if (typed_node->child_index[key_byte] != art_reference::EMPTY_MARKER) {
+          return &typed_node->child[typed_node->child_index[key_byte]];
+        }
+        return &null_node;
+      }
+      case art_reference::NODE_TYPE_256: {
+        auto* typed_node = static_cast<Node256*>(node);
+        return &typed_node->child[key_byte];
+      }
+    }
+    return &null_node;
+  }
+
+  // returns the leaf with the smallest key
+  static const Node* _minimum(const Node* node) {
+    if (node == nullptr || art_reference::is_leaf(node)) {
+      return node;
+    }
+    switch (node->type) {
+      case art_reference::NODE_TYPE_4:
+        return _minimum(static_cast<const Node4*>(node)->child[0]);
+      case art_reference::NODE_TYPE_16:
+        return _minimum(static_cast<const Node16*>(node)->child[0]);
+      case art_reference::NODE_TYPE_48: {
+        const auto* typed_node = static_cast<const Node48*>(node);
+        auto key_byte = 0u;
+        while (typed_node->child_index[key_byte] == art_reference::EMPTY_MARKER) {
+          ++key_byte;
+        }
+        return _minimum(typed_node->child[typed_node->child_index[key_byte]]);
+      }
+      case art_reference::NODE_TYPE_256: {
+        const auto* typed_node = static_cast<const Node256*>(node);
+        auto key_byte = 0u;
+        while (typed_node->child[key_byte] == nullptr) {
+          ++key_byte;
+        }
+        return _minimum(typed_node->child[key_byte]);
+      }
+    }
+    return nullptr;
+  }
+
+  // checks if the key of the leaf is equal to the searched key
+  static bool _leaf_matches(const Node* leaf, const uint8_t key[], const uint32_t depth) {
+    if (depth == KEY_LENGTH) {
+      return true;
+    }
+    uint8_t leaf_key[KEY_LENGTH];
+    _load_key(art_reference::leaf_value(leaf), leaf_key);
+    return std::memcmp(leaf_key + depth, key + depth, KEY_LENGTH - depth) == 0;
+  }
+
+  // compares the key with the prefix of the node and returns the number of matching bytes
+  static uint32_t _prefix_mismatch(const Node* node, const uint8_t key[], const uint32_t depth) {
+    uint32_t position = 0;
+    if (node->prefix_length > art_reference::MAX_PREFIX_LENGTH) {
+      for (; position < art_reference::MAX_PREFIX_LENGTH; ++position) {
+        if (key[depth + position] != node->prefix[position]) {
+          return position;
+        }
+      }
+      uint8_t min_key[KEY_LENGTH];
+      _load_key(art_reference::leaf_value(_minimum(node)), min_key);
+      for (; position < node->prefix_length; ++position) {
+        if (key[depth + position] != min_key[depth + position]) {
+          return position;
+        }
+      }
+    } else {
+      for (; position < node->prefix_length; ++position) {
+        if (key[depth + position] != node->prefix[position]) {
+          return position;
+        }
+      }
+    }
+    return position;
+  }
+
+  // Optimistic lookup: prefixes that are longer than the stored prefix are skipped and the key is checked at the leaf.
+  static const Node* _lookup(Node* node, const uint8_t key[]) {
+    auto depth = uint32_t{0};
+    auto skipped_prefix = false;
+    while (node != nullptr) {
+      if (art_reference::is_leaf(node)) {
+        if (!skipped_prefix && depth == KEY_LENGTH) {
+          return node;
+        }
+        return _leaf_matches(node, key, skipped_prefix ? 0 : depth) ? node : nullptr;
+      }
+
+      if (node->prefix_length > 0) {
+        if (node->prefix_length < art_reference::MAX_PREFIX_LENGTH) {
+          for (uint32_t position = 0; position < node->prefix_length; ++position) {
+            if (key[depth + position] != node->prefix[position]) {
+              return nullptr;
+            }
+          }
+        } else {
+          skipped_prefix = true;
+        }
+        depth += node->prefix_length;
+      }
+
+      node = *_find_child(node, key[depth]);
+      ++depth;
+    }
+    return nullptr;
+  }
+
+  static void _copy_prefix(const Node* source, Node* destination) {
+    destination->prefix_length = source->prefix_length;
+    std::memcpy(destination->prefix, source->prefix, std::min(source->prefix_length, art_reference::MAX_PREFIX_LENGTH));
+  }
+
+  static void _insert(Node* node, Node** node_reference, const uint8_t key[], uint32_t depth, const uintptr_t value) {
+    if (node == nullptr) {
+      *node_reference = art_reference::make_leaf(value);
+      return;
+    }
+
+    if (art_reference::is_leaf(node)) {
+      // replace the leaf with a Node4 and store both leaves in it
+      uint8_t existing_key[KEY_LENGTH];
+      _load_key(art_reference::leaf_value(node), existing_key);
+      if (std::memcmp(existing_key + depth, key + depth, KEY_LENGTH - depth) == 0) {
+        // the key is already stored
+        return;
+      }
+      auto new_prefix_length = uint32_t{0};
+      while (existing_key[depth + new_prefix_length] == key[depth + new_prefix_length]) {
+        ++new_prefix_length;
+      }
+
+      auto* new_node = new Node4();
+      new_node->prefix_length = new_prefix_length;
+      std::memcpy(new_node->prefix, key + depth, std::min(new_prefix_length, art_reference::MAX_PREFIX_LENGTH));
+      *node_reference = new_node;
+
+      _insert_node_4(new_node, node_reference, existing_key[depth + new_prefix_length], node);
+      _insert_node_4(new_node, node_reference, key[depth + new_prefix_length], art_reference::make_leaf(value));
+      return;
+    }
+
+    // handle the prefix of the inner node
+    if (node->prefix_length > 0) {
+      const auto mismatch_position = _prefix_mismatch(node, key, depth);
+      if (mismatch_position != node->prefix_length) {
+        // the prefix differs, create a new node
+        auto* new_node = new Node4();
+        *node_reference = new_node;
+        new_node->prefix_length = mismatch_position;
+        std::memcpy(new_node->prefix, node->prefix, std::min(mismatch_position, art_reference::MAX_PREFIX_LENGTH));
+        // break up the prefix
+        if (node->prefix_length < art_reference::MAX_PREFIX_LENGTH) {
+          _insert_node_4(new_node, node_reference, node->prefix[mismatch_position], node);
+          node->prefix_length -= (mismatch_position + 1);
+          std::memmove(node->prefix, node->prefix + mismatch_position + 1,
+                       std::min(node->prefix_length, art_reference::MAX_PREFIX_LENGTH));
+        } else {
+          node->prefix_length -= (mismatch_position + 1);
+          uint8_t min_key[KEY_LENGTH];
+          _load_key(art_reference::leaf_value(_minimum(node)), min_key);
+          _insert_node_4(new_node, node_reference, min_key[depth + mismatch_position], node);
+          std::memmove(node->prefix, min_key + depth + mismatch_position + 1,
+                       std::min(node->prefix_length, art_reference::MAX_PREFIX_LENGTH));
+        }
+        _insert_node_4(new_node, node_reference, key[depth + mismatch_position], art_reference::make_leaf(value));
+        return;
+      }
+      depth += node->prefix_length;
+    }
+
+    // recurse
+    auto** child = _find_child(node, key[depth]);
+    if (*child != nullptr) {
+      _insert(*child, child, key, depth + 1, value);
+      return;
+    }
+
+    // insert the leaf into the inner node
+    auto* new_node = art_reference::make_leaf(value);
+    switch (node->type) {
+      case art_reference::NODE_TYPE_4:
+        _insert_node_4(static_cast<Node4*>(node), node_reference, key[depth], new_node);
+        break;
+      case art_reference::NODE_TYPE_16:
+        _insert_node_16(static_cast<Node16*>(node), node_reference, key[depth], new_node);
+        break;
+      case art_reference::NODE_TYPE_48:
+        _insert_node_48(static_cast<Node48*>(node), node_reference, key[depth], new_node);
+        break;
+      case art_reference::NODE_TYPE_256:
+        _insert_node_256(static_cast<Node256*>(node), key[depth], new_node);
+        break;
+    }
+  }
+
+  static void _insert_node_4(Node4* node, Node** node_reference, const uint8_t key_byte, Node* child) {
+    if (node->count < 4) {
+      uint32_t position = 0;
+      while (position < node->count && node->key[position] < key_byte) {
+        ++position;
+      }
+      std::memmove(node->key + position + 1, node->key + position, node->count - position);
+      std::memmove(node->child + position + 1, node->child + position, (node->count - position) * sizeof(Node*));
+      node->key[position] = key_byte;
+      node->child[position] = child;
+      ++node->count;
+      return;
+    }
+
+    // grow to Node16
+    auto* new_node = new Node16();
+    *node_reference = new_node;
+    new_node->count = 4;
+    _copy_prefix(node, new_node);
+    for (uint32_t index = 0; index < 4; ++index) {
+      new_node->key[index] = art_reference::flip_sign(node->key[index]);
+    }
+    std::memcpy(new_node->child, node->child, node->count * sizeof(Node*));
+    delete node;
+    _insert_node_16(new_node, node_reference, key_byte, child);
+  }
+
+  static void _insert_node_16(Node16* node, Node** node_reference, const uint8_t key_byte, Node* child) {
+    if (node->count < 16) {
+      const auto key_byte_flipped = art_reference::flip_sign(key_byte);
+      const auto comparison =
+          _mm_cmplt_epi8(_mm_set1_epi8(static_cast<char>(key_byte_flipped)), art_reference::load_keys(node->key));
+      const auto bitfield = static_cast<uint32_t>(_mm_movemask_epi8(comparison)) & (0xFFFFu >> (16 - node->count));
+      const auto position = bitfield != 0 ? static_cast<uint32_t>(__builtin_ctz(bitfield)) : node->count;
+      std::memmove(node->key + position + 1, node->key + position, node->count - position);
+      std::memmove(node->child + position + 1, node->child + position, (node->count - position) * sizeof(Node*));
+      node->key[position] = key_byte_flipped;
+      node->child[position] = child;
+      ++node->count;
+      return;
+    }
+
+    // grow to Node48
+    auto* new_node = new Node48();
+    *node_reference = new_node;
+    std::memcpy(new_node->child, node->child, node->count * sizeof(Node*));
+    for (uint32_t index = 0; index < node->count; ++index) {
+      new_node->child_index[art_reference::flip_sign(node->key[index])] = static_cast<uint8_t>(index);
+    }
+    _copy_prefix(node, new_node);
+    new_node->count = node->count;
+    delete node;
+    _insert_node_48(new_node, node_reference, key_byte, child);
+  }
+
+  static void _insert_node_48(Node48* node, Node** node_reference, const uint8_t key_byte, Node* child) {
+    if (node->count < 48) {
+      uint32_t position = node->count;
+      if (node->child[position] != nullptr) {
+        position = 0;
+        while (node->child[position] != nullptr) {
+          ++position;
+        }
+      }
+      node->child[position] = child;
+      node->child_index[key_byte] = static_cast<uint8_t>(position);
+      ++node->count;
+      return;
+    }
+
+    // grow to Node256
+    auto* new_node = new Node256();
+    for (uint32_t index = 0; index < 256; ++index) {
+      if (node->child_index[index] != art_reference::EMPTY_MARKER) {
+        new_node->child[index] = node->child[node->child_index[index]];
+      }
+    }
+    new_node->count = node->count;
+    _copy_prefix(node, new_node);
+    *node_reference = new_node;
+    delete node;
+    _insert_node_256(new_node, key_byte, child);
+  }
+
+  static void _insert_node_256(Node256* node, const uint8_t key_byte, Node* child) {
+    ++node->count;
+    node->child[key_byte] = child;
+  }
+
+  static void _erase(Node* node, Node** node_reference, const uint8_t key[], uint32_t depth) {
+    if (node == nullptr) {
+      return;
+    }
+
+    if (art_reference::is_leaf(node)) {
+      // make sure that we have the right leaf
+      if (_leaf_matches(node, key, depth)) {
+        *node_reference = nullptr;
+      }
+      return;
+    }
+
+    // handle the prefix
+    if (node->prefix_length > 0) {
+      if (_prefix_mismatch(node, key, depth) != node->prefix_length) {
+        return;
+      }
+      depth += node->prefix_length;
+    }
+
+    auto** child = _find_child(node, key[depth]);
+    if (*child == nullptr || !art_reference::is_leaf(*child) || !_leaf_matches(*child, key, depth)) {
+      _erase(*child, child, key, depth + 1);
+      return;
+    }
+
+    // the leaf is found, erase it from the inner node
+    switch (node->type) {
+      case art_reference::NODE_TYPE_4:
+        _erase_node_4(static_cast<Node4*>(node), node_reference, child);
+        break;
+      case art_reference::NODE_TYPE_16:
+        _erase_node_16(static_cast<Node16*>(node), node_reference, child);
+        break;
+      case art_reference::NODE_TYPE_48:
+        _erase_node_48(static_cast<Node48*>(node), node_reference, key[depth]);
+        break;
+      case art_reference::NODE_TYPE_256:
+        _erase_node_256(static_cast<Node256*>(node), node_reference, key[depth]);
+        break;
+    }
+  }
+
+  static void _erase_node_4(Node4* node, Node** node_reference, Node** leaf_place) {
+    const auto position = static_cast<uint32_t>(leaf_place - node->child);
+    std::memmove(node->key + position, node->key + position + 1, node->count - position - 1);
+    std::memmove(node->child + position, node->child + position + 1, (node->count - position - 1) * sizeof(Node*));
+    --node->count;
+
+    if (node->count == 1) {
+      // get rid of the one-way node
+      auto* child = node->child[0];
+      if (!art_reference::is_leaf(child)) {
+        // concatenate the prefixes
+        auto length = node->prefix_length;
+        if (length < art_reference::MAX_PREFIX_LENGTH) {
+          node->prefix[length] = node->key[0];
+          ++length;
+        }
+        if (length < art_reference::MAX_PREFIX_LENGTH) {
+          const auto child_length = std::min(child->prefix_length, art_reference::MAX_PREFIX_LENGTH - length);
+          std::memcpy(node->prefix + length, child->prefix, child_length);
+          length += child_length;
+        }
+        // store the concatenated prefix
+        std::memcpy(child->prefix, node->prefix, std::min(length, art_reference::MAX_PREFIX_LENGTH));
+        child->prefix_length += node->prefix_length + 1;
+      }
+      *node_reference = child;
+      delete node;
+    }
+  }
+
+  static void _erase_node_16(Node16* node, Node** node_reference, Node** leaf_place) {
+    const auto position = static_cast<uint32_t>(leaf_place - node->child);
+    std::memmove(node->key + position, node->key + position + 1, node->count - position - 1);
+    std::memmove(node->child + position, node->child + position + 1, (node->count - position - 1) * sizeof(Node*));
+    --node->count;
+
+    if (node->count == 3) {
+      // shrink to Node4
+      auto* new_node = new Node4();
+      new_node->count = node->count;
+      _copy_prefix(node, new_node);
+      for (uint32_t index = 0; index < 4; ++index) {
+        new_node->key[index] = art_reference::flip_sign(node->key[index]);
+      }
+      std::memcpy(new_node->child, node->child, sizeof(Node*) * 4);
+      *node_reference = new_node;
+      delete node;
+    }
+  }
+
+  static void _erase_node_48(Node48* node, Node** node_reference, const uint8_t key_byte) {
+    node->child[node->child_index[key_byte]] = nullptr;
+    node->child_index[key_byte] = art_reference::EMPTY_MARKER;
+    --node->count;
+
+    if (node->count == 12) {
+      // shrink to Node16
+      auto* new_node = new Node16();
+      *node_reference = new_node;
+      _copy_prefix(node, new_node);
+      for (uint32_t index = 0; index < 256; ++index) {
+        if (node->child_index[index] != art_reference::EMPTY_MARKER) {
+          new_node->key[new_node->count] = art_reference::flip_sign(static_cast<uint8_t>(index));
+          new_node->child[new_node->count] = node->child[node->child_index[index]];
+          ++new_node->count;
+        }
+      }
+      delete node;
+    }
+  }
+
+  static void _erase_node_256(Node256* node, Node** node_reference, const uint8_t key_byte) {
+    node->child[key_byte] = nullptr;
+    --node->count;
+
+    if (node->count == 37) {
+      // shrink to Node48
+      auto* new_node = new Node48();
+      *node_reference = new_node;
+      _copy_prefix(node, new_node);
+      for (uint32_t index = 0; index < 256; ++index) {
+        if (node->child[index] != nullptr) {
+          new_node->child_index[index] = static_cast<uint8_t>(new_node->count);
+          new_node->child[new_node->count] = node->child[index];
+          ++new_node->count;
+        }
+      }
+      delete node;
+    }
+  }
+
+  // Appends the values of the leaves in the subtree whose keys are within the bounds, in key order. lower_bound_path
+  // (upper_bound_path) states that the path to the node equals the lower (upper) bound, i.e., the bound restricts the
+  // children of the node. Otherwise, all keys of the subtree are greater than the lower (less than the upper) bound.
+  static void _range_lookup(const Node* node, uint32_t depth, const uint8_t lower_bound[], const uint8_t upper_bound[],
+                            bool lower_bound_path, bool upper_bound_path, std::vector<Value>& result) {
+    if (node == nullptr) {
+      return;
+    }
+
+    if (art_reference::is_leaf(node)) {
+      // due to lazy expansion, the leaf's key is only partially checked by the path
+      uint8_t leaf_key[KEY_LENGTH];
+      _load_key(art_reference::leaf_value(node), leaf_key);
+      if (std::memcmp(leaf_key, lower_bound, KEY_LENGTH) >= 0 && std::memcmp(leaf_key, upper_bound, KEY_LENGTH) <= 0) {
+        result.emplace_back(static_cast<Value>(art_reference::leaf_value(node)));
+      }
+      return;
+    }
+
+    if (node->prefix_length > 0 && (lower_bound_path || upper_bound_path)) {
+      const uint8_t* prefix = node->prefix;
+      uint8_t min_key[KEY_LENGTH];
+      if (node->prefix_length > art_reference::MAX_PREFIX_LENGTH) {
+        _load_key(art_reference::leaf_value(_minimum(node)), min_key);
+        prefix = min_key + depth;
+      }
+      if (lower_bound_path) {
+        const auto comparison = std::memcmp(prefix, lower_bound + depth, node->prefix_length);
+        if (comparison < 0) {
+          return;
+        }
+        lower_bound_path = comparison == 0;
+      }
+      if (upper_bound_path) {
+        const auto comparison = std::memcmp(prefix, upper_bound + depth, node->prefix_length);
+        if (comparison > 0) {
+          return;
+        }
+        upper_bound_path = comparison == 0;
+      }
+    }
+    depth += node->prefix_length;
+
+    const auto visit = [&](const uint8_t key_byte, const Node* child) {
+      if ((lower_bound_path && key_byte < lower_bound[depth]) || (upper_bound_path && key_byte > upper_bound[depth])) {
+        return;
+      }
+      _range_lookup(child, depth + 1, lower_bound, upper_bound, lower_bound_path && key_byte == lower_bound[depth],
+                    upper_bound_path && key_byte == upper_bound[depth], result);
+    };
+
+    switch (node->type) {
+      case art_reference::NODE_TYPE_4: {
+        const auto* typed_node = static_cast<const Node4*>(node);
+        for (uint32_t index = 0; index < typed_node->count; ++index) {
+          visit(typed_node->key[index], typed_node->child[index]);
+        }
+        return;
+      }
+      case art_reference::NODE_TYPE_16: {
+        const auto* typed_node = static_cast<const Node16*>(node);
+        for (uint32_t index = 0; index < typed_node->count; ++index) {
+          visit(art_reference::flip_sign(typed_node->key[index]), typed_node->child[index]);
+        }
+        return;
+      }
+      case art_reference::NODE_TYPE_48: {
+        const auto* typed_node = static_cast<const Node48*>(node);
+        for (uint32_t index = 0; index < 256; ++index) {
+          if (typed_node->child_index[index] != art_reference::EMPTY_MARKER) {
+            visit(static_cast<uint8_t>(index), typed_node->child[typed_node->child_index[index]]);
+          }
+        }
+        return;
+      }
+      case art_reference::NODE_TYPE_256: {
+        const auto* typed_node = static_cast<const Node256*>(node);
+        for (uint32_t index = 0; index < 256; ++index) {
+          if (typed_node->child[index] != nullptr) {
+            visit(static_cast<uint8_t>(index), typed_node->child[index]);
+          }
+        }
+        return;
+      }
+    }
+  }
+
+  Node* _root = nullptr;
+};
+
+}  // namespace imib
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <algorithm>
 #include <string>
 #include <vector>
 
@@ -26,7 +27,7 @@ class BTreeGoogleAbseil {
       case IndexOperationType::BulkInsert:
         return true;
       case IndexOperationType::BulkErase:
-        return false;
+        return true;
       case IndexOperationType::InsertEntry:
         return true;
       case IndexOperationType::EraseEntry:
@@ -38,26 +39,60 @@ class BTreeGoogleAbseil {
     }
   }
 
+  static bool supports_concurrent(const IndexOperationType operation_type) {
+    return operation_type == IndexOperationType::EqualityLookup || operation_type == IndexOperationType::RangeLookup;
+  }
+
   static const std::string name() { return "Abseil B-Tree"; }
 
   static IndexType type() { return IndexType::BTreeAbseil; }
 
   void bulk_load(const Data<Key, Value>& data) { throw std::logic_error("Not supported."); }
 
-  void bulk_insert(const Data<Key, Value>& data) { _btree_map.insert(data.entries.cbegin(), data.entries.cend()); }
+  void bulk_insert(const Data<Key, Value>& data) { _btree_map.insert(data.entries().cbegin(), data.entries().cend()); }
 
-  void bulk_erase(const Data<Key, Value>& data) { throw std::logic_error("Not supported."); }
+  // Each run of keys to erase that are stored next to each other, e.g., the key range of a dropped partition, is
+  // erased with one range erase instead of descending the tree once per key.
+  void bulk_erase(const Data<Key, Value>& data) {
+    auto keys = std::vector<Key>{};
+    keys.reserve(data.entries().size());
+    for (const auto& entry : data.entries()) {
+      keys.push_back(entry.first);
+    }
+    std::sort(keys.begin(), keys.end());
+
+    auto key_iter = keys.cbegin();
+    while (key_iter != keys.cend()) {
+      const auto first = _btree_map.lower_bound(*key_iter);
+      auto last = first;
+      while (key_iter != keys.cend() && last != _btree_map.end() && last->first == *key_iter) {
+        ++last;
+        ++key_iter;
+      }
+      if (first == last) {
+        // the key is not stored
+        ++key_iter;
+      } else {
+        _btree_map.erase(first, last);
+      }
+    }
+  }
 
   void insert(const Key& key, const Value& value) { _btree_map.emplace(key, value); }
 
   void erase(const Key& key, const Value& value) { _btree_map.erase(key); }
 
   std::vector<Value> equality_lookup(const Key& key) const {
+    auto result = std::vector<Value>{};
+    equality_lookup(key, result);
+    return result;
+  }
+
+  void equality_lookup(const Key& key, std::vector<Value>& result) const {
     const auto found = _btree_map.find(key);
     if (found != _btree_map.cend()) {
-      return std::vector<Value>{found->second};
+      result.emplace_back(found->second);
     }
-    return std::vector<Value>{};
 
     // for multimap:
     // https://quick-bench.com/q/p_82lXxX-9t5jamnDm751DHowO8
@@ -72,15 +107,18 @@ class BTreeGoogleAbseil {
   }
 
   std::vector<Value> range_lookup(const Key& lower_bound_key, const Key& upper_bound_key) const {
+    auto result = std::vector<Value>{};
+    range_lookup(lower_bound_key, upper_bound_key, result);
+    return result;
+  }
+
+  void range_lookup(const Key& lower_bound_key, const Key& upper_bound_key, std::vector<Value>& result) const {
     auto lower_bound = _btree_map.lower_bound(lower_bound_key);
     const auto upper_bound = _btree_map.upper_bound(upper_bound_key);
 
-    auto result = std::vector<Value>{};
-    result.reserve(std::distance(lower_bound, upper_bound));
     for (; lower_bound != upper_bound; ++lower_bound) {
       result.emplace_back(lower_bound->second);
     }
-    return result;
   }
 
  protected:
@@ -0,0 +1,104 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "absl/container/btree_map.h"
+
+#include "types.hpp"
+
+// References:
+// https://abseil.io/docs/cpp/guides/container
+// https://github.com/abseil/abseil-cpp
+
+// The multimap variant of the BTreeGoogleAbseil. The duplicates of a key are adjacent and returned in the order they
+// were inserted.
+
+namespace imib {
+
+template <typename Key, typename Value>
+class BTreeGoogleAbseilMultimap {
+ public:
+  static bool supports_key_duplicates() { return true; }
+
+  static bool supports(const IndexOperationType operation_type) {
+    switch (operation_type) {
+      case IndexOperationType::BulkLoad:
+        return false;
+      case IndexOperationType::BulkInsert:
+        return true;
+      case IndexOperationType::BulkErase:
+        return false;
+      case IndexOperationType::InsertEntry:
+        return true;
+      case IndexOperationType::EraseEntry:
+        return true;
+      case IndexOperationType::EqualityLookup:
+        return true;
+      case IndexOperationType::RangeLookup:
+        return true;
+    }
+  }
+
+  static bool supports_concurrent(const IndexOperationType operation_type) {
+    return operation_type == IndexOperationType::EqualityLookup || operation_type == IndexOperationType::RangeLookup;
+  }
+
+  static const std::string name() { return "Abseil B-Tree Multimap"; }
+
+  static IndexType type() { return IndexType::BTreeAbseilMultimap; }
+
+  void bulk_load(const Data<Key, Value>& data) { throw std::logic_error("Not supported."); }
+
+  void bulk_insert(const Data<Key, Value>& data) {
+    _btree_multimap.insert(data.entries().cbegin(), data.entries().cend());
+  }
+
+  void bulk_erase(const Data<Key, Value>& data) { throw std::logic_error("Not supported."); }
+
+  void insert(const Key& key, const Value& value) { _btree_multimap.emplace(key, value); }
+
+  // erases only the entry with the given value
+  void erase(const Key& key, const Value& value) {
+    const auto range = _btree_multimap.equal_range(key);
+    for (auto iter = range.first; iter != range.second; ++iter) {
+      if (iter->second == value) {
+        _btree_multimap.erase(iter);
+        return;
+      }
+    }
+  }
+
+  std::vector<Value> equality_lookup(const Key& key) const {
+    auto result = std::vector<Value>{};
+    equality_lookup(key, result);
+    return result;
+  }
+
+  void equality_lookup(const Key& key, std::vector<Value>& result) const {
+    const auto range = _btree_multimap.equal_range(key);
+    for (auto iter = range.first; iter != range.second; ++iter) {
+      result.emplace_back(iter->second);
+    }
+  }
+
+  std::vector<Value> range_lookup(const Key& lower_bound_key, const Key& upper_bound_key) const {
+    auto result = std::vector<Value>{};
+    range_lookup(lower_bound_key, upper_bound_key, result);
+    return result;
+  }
+
+  void range_lookup(const Key& lower_bound_key, const Key& upper_bound_key, std::vector<Value>& result) const {
+    auto lower_bound = _btree_multimap.lower_bound(lower_bound_key);
+    const auto upper_bound = _btree_multimap.upper_bound(upper_bound_key);
+
+    for (; lower_bound != upper_bound; ++lower_bound) {
+      result.emplace_back(lower_bound->second);
+    }
+  }
+
+ protected:
+  absl::btree_multimap<Key, Value> _btree_multimap;
+};
+
+}  // namespace imib
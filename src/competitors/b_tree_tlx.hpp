@@ -1,6 +1,9 @@
 #pragma once
 
+#include <algorithm>
+#include <cstddef>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "tlx/container/btree_map.hpp"
@@ -26,7 +29,7 @@ class BTreeTlx {
       case IndexOperationType::BulkInsert:
         return true;
       case IndexOperationType::BulkErase:
-        return false;
+        return true;
       case IndexOperationType::InsertEntry:
         return true;
       case IndexOperationType::EraseEntry:
@@ -38,27 +41,67 @@ class BTreeTlx {
     }
   }
 
+  static bool supports_concurrent(const IndexOperationType operation_type) {
+    return operation_type == IndexOperationType::EqualityLookup || operation_type == IndexOperationType::RangeLookup;
+  }
+
   static const std::string name() { return "TLX B+ Tree"; }
 
   static IndexType type() { return IndexType::BTreeTLX; }
 
   // sorted entries are required!
-  void bulk_load(const Data<Key, Value>& data) { _btree_map.bulk_load(data.entries.cbegin(), data.entries.cend()); }
+  void bulk_load(const Data<Key, Value>& data) { _btree_map.bulk_load(data.entries().cbegin(), data.entries().cend()); }
+
+  void bulk_insert(const Data<Key, Value>& data) { _btree_map.insert(data.entries().cbegin(), data.entries().cend()); }
+
+  // The TLX B+ tree does not implement the erase of an iterator range. Thus, if many entries are erased, e.g., the key
+  // range of a dropped partition, the remaining entries are bulk loaded into a new tree, which needs one pass over the
+  // tree and fills the new leaves completely. Few entries are erased one by one in key order.
+  void bulk_erase(const Data<Key, Value>& data) {
+    auto keys = std::vector<Key>{};
+    keys.reserve(data.entries().size());
+    for (const auto& entry : data.entries()) {
+      keys.push_back(entry.first);
+    }
+    std::sort(keys.begin(), keys.end());
 
-  void bulk_insert(const Data<Key, Value>& data) { _btree_map.insert(data.entries.cbegin(), data.entries.cend()); }
+    if (keys.size() * REBUILD_ERASE_RATIO < _btree_map.size()) {
+      for (const auto& key : keys) {
+        _btree_map.erase(key);
+      }
+      return;
+    }
 
-  void bulk_erase(const Data<Key, Value>& data) { throw std::logic_error("Not supported."); }
+    auto remaining_entries = std::vector<std::pair<Key, Value>>{};
+    remaining_entries.reserve(_btree_map.size());
+    auto key_iter = keys.cbegin();
+    for (const auto& entry : _btree_map) {
+      while (key_iter != keys.cend() && *key_iter < entry.first) {
+        ++key_iter;
+      }
+      if (key_iter == keys.cend() || entry.first < *key_iter) {
+        remaining_entries.emplace_back(entry.first, entry.second);
+      }
+    }
+    _btree_map.clear();
+    _btree_map.bulk_load(remaining_entries.cbegin(), remaining_entries.cend());
+  }
 
   void insert(const Key& key, const Value& value) { _btree_map.insert2(key, value); }
 
   void erase(const Key& key, const Value& value) { _btree_map.erase(key); }
 
   std::vector<Value> equality_lookup(const Key& key) const {
+    auto result = std::vector<Value>{};
+    equality_lookup(key, result);
+    return result;
+  }
+
+  void equality_lookup(const Key& key, std::vector<Value>& result) const {
     const auto found = _btree_map.find(key);
     if (found != _btree_map.end()) {
-      return std::vector<Value>{found->second};
+      result.emplace_back(found->second);
     }
-    return std::vector<Value>{};
     // for multi map
     // const auto range = _btree_multimap.equal_range(key);
     // auto result = std::vector<Value>(std::distance(range.first, range.second));
@@ -71,18 +114,24 @@ class BTreeTlx {
   }
 
   std::vector<Value> range_lookup(const Key& lower_bound_key, const Key& upper_bound_key) const {
+    auto result = std::vector<Value>{};
+    range_lookup(lower_bound_key, upper_bound_key, result);
+    return result;
+  }
+
+  void range_lookup(const Key& lower_bound_key, const Key& upper_bound_key, std::vector<Value>& result) const {
     auto lower_bound = _btree_map.lower_bound(lower_bound_key);
     const auto upper_bound = _btree_map.upper_bound(upper_bound_key);
 
-    auto result = std::vector<Value>{};
-    result.reserve(std::distance(lower_bound, upper_bound));
     for (; lower_bound != upper_bound; ++lower_bound) {
       result.emplace_back(lower_bound->second);
     }
-    return result;
   }
 
  protected:
+  // the tree is rebuilt if at least one in REBUILD_ERASE_RATIO entries is erased
+  static constexpr size_t REBUILD_ERASE_RATIO = 8;
+
   tlx::btree_map<Key, Value> _btree_map;
 };
 
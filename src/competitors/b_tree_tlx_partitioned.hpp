@@ -0,0 +1,188 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "tlx/container/btree_map.hpp"
+
+#include "types.hpp"
+#include "utils/parallel_sort.hpp"
+
+// References:
+// https://panthema.net/2018/0528-tlx-library/
+// https://github.com/tlx/tlx/tree/master/tlx/container
+
+// The TLX B+ tree builds its leaves and inner levels from a sorted range with one thread and does not expose its nodes.
+// The partitioned variant splits the sorted entries of a bulk load into contiguous key range partitions and each
+// thread bulk loads its partition into a tree of its own. The first keys of the partitions form a root level above the
+// trees, which routes each operation to the tree of its key range. Like the BTreeTlx, its bulk_load function requires
+// a sorted range of entries and an empty index.
+
+namespace imib {
+
+template <typename Key, typename Value>
+class BTreeTlxPartitioned {
+ public:
+  // a partition count of 0 builds one partition per thread that ParallelSort uses for the entries of a bulk load
+  explicit BTreeTlxPartitioned(const size_t partition_count = 0) : _partition_count{partition_count} {}
+
+  static bool supports_key_duplicates() { return false; }
+
+  static bool supports(const IndexOperationType operation_type) {
+    switch (operation_type) {
+      case IndexOperationType::BulkLoad:
+        return true;
+      case IndexOperationType::BulkInsert:
+        return true;
+      case IndexOperationType::BulkErase:
+        return true;
+      case IndexOperationType::InsertEntry:
+        return true;
+      case IndexOperationType::EraseEntry:
+        return true;
+      case IndexOperationType::EqualityLookup:
+        return true;
+      case IndexOperationType::RangeLookup:
+        return true;
+    }
+  }
+
+  static bool supports_concurrent(const IndexOperationType operation_type) {
+    return operation_type == IndexOperationType::EqualityLookup || operation_type == IndexOperationType::RangeLookup;
+  }
+
+  static const std::string name() { return "Partitioned TLX B+ Tree"; }
+
+  static IndexType type() { return IndexType::BTreeTLXPartitioned; }
+
+  // sorted entries are required!
+  void bulk_load(const Data<Key, Value>& data) { _build(data.entries()); }
+
+  void bulk_insert(const Data<Key, Value>& data) {
+    for (const auto& entry : data.entries()) {
+      _partition(entry.first).insert(entry);
+    }
+  }
+
+  // Like the BTreeTlx, many erased entries rebuild the trees from the remaining entries, which are partitioned again.
+  // Few entries are erased one by one in key order.
+  void bulk_erase(const Data<Key, Value>& data) {
+    auto keys = std::vector<Key>{};
+    keys.reserve(data.entries().size());
+    for (const auto& entry : data.entries()) {
+      keys.push_back(entry.first);
+    }
+    std::sort(keys.begin(), keys.end());
+
+    const auto size = _size();
+    if (keys.size() * REBUILD_ERASE_RATIO < size) {
+      for (const auto& key : keys) {
+        _partition(key).erase(key);
+      }
+      return;
+    }
+
+    auto remaining_entries = std::vector<std::pair<Key, Value>>{};
+    remaining_entries.reserve(size);
+    auto key_iter = keys.cbegin();
+    for (const auto& partition : _partitions) {
+      for (const auto& entry : partition) {
+        while (key_iter != keys.cend() && *key_iter < entry.first) {
+          ++key_iter;
+        }
+        if (key_iter == keys.cend() || entry.first < *key_iter) {
+          remaining_entries.emplace_back(entry.first, entry.second);
+        }
+      }
+    }
+    _build(remaining_entries);
+  }
+
+  void insert(const Key& key, const Value& value) { _partition(key).insert2(key, value); }
+
+  void erase(const Key& key, const Value& value) { _partition(key).erase(key); }
+
+  std::vector<Value> equality_lookup(const Key& key) const {
+    auto result = std::vector<Value>{};
+    equality_lookup(key, result);
+    return result;
+  }
+
+  void equality_lookup(const Key& key, std::vector<Value>& result) const {
+    const auto& partition = _partitions[_partition_id(key)];
+    const auto found = partition.find(key);
+    if (found != partition.end()) {
+      result.emplace_back(found->second);
+    }
+  }
+
+  std::vector<Value> range_lookup(const Key& lower_bound_key, const Key& upper_bound_key) const {
+    auto result = std::vector<Value>{};
+    range_lookup(lower_bound_key, upper_bound_key, result);
+    return result;
+  }
+
+  void range_lookup(const Key& lower_bound_key, const Key& upper_bound_key, std::vector<Value>& result) const {
+    const auto last_partition_id = _partition_id(upper_bound_key);
+    for (auto partition_id = _partition_id(lower_bound_key); partition_id <= last_partition_id; ++partition_id) {
+      const auto& partition = _partitions[partition_id];
+      auto lower_bound = partition.lower_bound(lower_bound_key);
+      const auto upper_bound = partition.upper_bound(upper_bound_key);
+
+      for (; lower_bound != upper_bound; ++lower_bound) {
+        result.emplace_back(lower_bound->second);
+      }
+    }
+  }
+
+  size_t partition_count() const { return _partitions.size(); }
+
+ protected:
+  // the tree is rebuilt if at least one in REBUILD_ERASE_RATIO entries is erased
+  static constexpr size_t REBUILD_ERASE_RATIO = 8;
+
+  // Bulk loads the sorted entries with one thread per partition. Each partition holds at least one entry, such that
+  // its first key separates it from the previous partition.
+  void _build(const std::vector<std::pair<Key, Value>>& entries) {
+    const auto requested_count = _partition_count == 0 ? ParallelSort::range_count(entries.size()) : _partition_count;
+    const auto partition_count = std::clamp(requested_count, size_t{1}, std::max(entries.size(), size_t{1}));
+
+    _partitions = std::vector<tlx::btree_map<Key, Value>>(partition_count);
+    _partition_keys.assign(partition_count - 1, Key{});
+    const auto build_partition = [&](const size_t partition_id, const size_t begin, const size_t end) {
+      if (partition_id > 0) {
+        _partition_keys[partition_id - 1] = entries[begin].first;
+      }
+      _partitions[partition_id].bulk_load(entries.cbegin() + begin, entries.cbegin() + end);
+    };
+    ParallelSort::for_each_range(entries.size(), partition_count, build_partition);
+  }
+
+  // the partition whose key range contains the key, i.e., the last partition whose first key is not greater
+  size_t _partition_id(const Key& key) const {
+    return static_cast<size_t>(std::upper_bound(_partition_keys.cbegin(), _partition_keys.cend(), key) -
+                               _partition_keys.cbegin());
+  }
+
+  tlx::btree_map<Key, Value>& _partition(const Key& key) { return _partitions[_partition_id(key)]; }
+
+  size_t _size() const {
+    auto size = size_t{0};
+    for (const auto& partition : _partitions) {
+      size += partition.size();
+    }
+    return size;
+  }
+
+  // 0 if the bulk load selects the partition count by the number of entries
+  size_t _partition_count;
+  // the trees of the key ranges of the partitions, one tree until the first bulk load
+  std::vector<tlx::btree_map<Key, Value>> _partitions = std::vector<tlx::btree_map<Key, Value>>(1);
+  // the first key of each partition but the first one
+  std::vector<Key> _partition_keys;
+};
+
+}  // namespace imib
@@ -43,6 +43,11 @@ class BbTree {
     }
   }
 
+  static bool supports_concurrent(const IndexOperationType operation_type) {
+    // BBTree manages its own worker threads (see num_threads in the constructor) and is not called concurrently
+    return false;
+  }
+
   // BBTree(size_t dimensions, size_t num_threads)
   BbTree() : _bb_tree(BBTree(1, 1)) {
     static_assert(std::is_arithmetic<Key>::value, "Not an arithmetic type");
@@ -55,7 +60,15 @@ class BbTree {
   static IndexType type() { return IndexType::BBTree; }
 
   // inserts on already built index structures are not allowed
-  void bulk_load(const Data<Key, Value>& data) { _bb_tree.BulkInsert(data.keys_float, data.values); }
+  void bulk_load(const Data<Key, Value>& data) {
+    // the BBTree expects a vector of coordinates per key
+    auto keys = std::vector<std::vector<float>>{};
+    keys.reserve(data.keys_float().size());
+    for (const auto key : data.keys_float()) {
+      keys.push_back(std::vector<float>{key});
+    }
+    _bb_tree.BulkInsert(keys, data.values());
+  }
 
   void bulk_insert(const Data<Key, Value>& data) { throw std::logic_error("Not supported."); }
 
@@ -74,13 +87,17 @@ class BbTree {
   }
 
   std::vector<uint32_t> equality_lookup(const Key& key) const {
+    auto result = std::vector<uint32_t>{};
+    equality_lookup(key, result);
+    return result;
+  }
+
+  void equality_lookup(const Key& key, std::vector<uint32_t>& result) const {
     // narrowing issue! Key could exceed float max values
     assert(key == static_cast<Key>(static_cast<float>(key)));
-    const auto result = _bb_tree.SearchObject(std::vector<float>{static_cast<float>(key)});
-    if (result == NO_SEARCH_RESULT) {
-      return std::vector<uint32_t>{};
-    } else {
-      return std::vector<uint32_t>{result};
+    const auto found = _bb_tree.SearchObject(std::vector<float>{static_cast<float>(key)});
+    if (found != NO_SEARCH_RESULT) {
+      result.emplace_back(found);
     }
   }
 
@@ -92,6 +109,12 @@ class BbTree {
                                 std::vector<float>{static_cast<float>(upper_bound_key)});
   }
 
+  // BBTree::SearchRange returns a new vector, thus, this overload does not avoid its allocation
+  void range_lookup(const Key& lower_bound_key, const Key& upper_bound_key, std::vector<uint32_t>& result) {
+    const auto found = range_lookup(lower_bound_key, upper_bound_key);
+    result.insert(result.end(), found.cbegin(), found.cend());
+  }
+
  protected:
   BBTree _bb_tree;
 };
@@ -0,0 +1,125 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "bwtree.h"  // NOLINT
+
+#include "types.hpp"
+
+// supports: only unique keys, no support for key duplicates
+
+namespace imib {
+
+// The Bw-Tree stores the garbage collection id (gc id) of a thread in a thread-local variable that is shared by all
+// Bw-Tree instances. Thus, we track the instance the calling thread's gc id was assigned for. Instance ids start at 1.
+inline thread_local uint64_t bw_tree_gc_id_instance_id = 0;
+inline std::atomic<uint64_t> bw_tree_instance_count{0};
+
+// The open Bw-Tree is a latch-free B+ tree, see "Building a Bw-Tree Takes More Than Just Buzz Words" (SIGMOD 2018).
+// All supported operations can be executed concurrently. Each thread requires a gc id that is smaller than the number
+// of threads the tree's epoch-based garbage collection was prepared for. A thread gets a gc id assigned when it
+// accesses a tree for the first time or after it accessed another tree.
+template <typename Key, typename Value>
+class BwTreeIndex {
+ public:
+  static bool supports_key_duplicates() { return false; }
+
+  static bool supports(const IndexOperationType operation_type) {
+    switch (operation_type) {
+      case IndexOperationType::BulkLoad:
+        return false;
+      case IndexOperationType::BulkInsert:
+        return false;
+      case IndexOperationType::BulkErase:
+        return false;
+      case IndexOperationType::InsertEntry:
+        return true;
+      case IndexOperationType::EraseEntry:
+        return true;
+      case IndexOperationType::EqualityLookup:
+        return true;
+      case IndexOperationType::RangeLookup:
+        return true;
+    }
+  }
+
+  static bool supports_concurrent(const IndexOperationType operation_type) { return supports(operation_type); }
+
+  BwTreeIndex() : _instance_id(++bw_tree_instance_count) {
+    // the thread number is a static member of the Bw-Tree, thus, all instances have to use the same thread number
+    _tree.UpdateThreadLocal(MAX_THREAD_COUNT);
+  }
+
+  static const std::string name() { return "Open Bw-Tree"; }
+
+  static IndexType type() { return IndexType::BwTree; }
+
+  void bulk_load(const Data<Key, Value>& data) { throw std::logic_error("Not supported."); }
+
+  void bulk_insert(const Data<Key, Value>& data) { throw std::logic_error("Not supported."); }
+
+  void bulk_erase(const Data<Key, Value>& data) { throw std::logic_error("Not supported."); }
+
+  void insert(const Key& key, const Value& value) {
+    _assign_gc_id();
+    // The Bw-Tree supports key duplicates and only rejects duplicate key-value pairs. The predicate is satisfied by
+    // any value, thus, the entry is only inserted if the key is not stored yet.
+    auto predicate_satisfied = false;
+    _tree.ConditionalInsert(key, value, [](const auto&) { return true; }, &predicate_satisfied);
+  }
+
+  void erase(const Key& key, const Value& value) {
+    _assign_gc_id();
+    _tree.Delete(key, value);
+  }
+
+  std::vector<Value> equality_lookup(const Key& key) const {
+    auto result = std::vector<Value>{};
+    equality_lookup(key, result);
+    return result;
+  }
+
+  // GetValue appends the values to the result
+  void equality_lookup(const Key& key, std::vector<Value>& result) const {
+    _assign_gc_id();
+    _tree.GetValue(key, result);
+  }
+
+  std::vector<Value> range_lookup(const Key& lower_bound_key, const Key& upper_bound_key) const {
+    auto result = std::vector<Value>{};
+    range_lookup(lower_bound_key, upper_bound_key, result);
+    return result;
+  }
+
+  void range_lookup(const Key& lower_bound_key, const Key& upper_bound_key, std::vector<Value>& result) const {
+    _assign_gc_id();
+    for (auto iterator = _tree.Begin(lower_bound_key); !iterator.IsEnd() && iterator->first <= upper_bound_key;
+         ++iterator) {
+      result.emplace_back(iterator->second);
+    }
+  }
+
+ protected:
+  // Gc ids are assigned round robin. Thus, at most MAX_THREAD_COUNT threads can access a tree concurrently. Threads
+  // are not unregistered after they finished, i.e., a finished thread delays the garbage collection until its gc id
+  // is reassigned. Garbage that is not collected is freed when the tree is destructed.
+  static constexpr size_t MAX_THREAD_COUNT = 256;
+
+  void _assign_gc_id() const {
+    if (bw_tree_gc_id_instance_id != _instance_id) {
+      _tree.AssignGCID(static_cast<int>(_assigned_gc_id_count++ % MAX_THREAD_COUNT));
+      bw_tree_gc_id_instance_id = _instance_id;
+    }
+  }
+
+  const uint64_t _instance_id;
+  mutable std::atomic<size_t> _assigned_gc_id_count{0};
+  // the lookup functions of the Bw-Tree are not const
+  mutable wangziqi2016::index::BwTree<Key, Value> _tree;
+};
+
+}  // namespace imib
@@ -0,0 +1,158 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "types.hpp"
+#include "utils/parallel_sort.hpp"
+
+namespace imib {
+
+// Sorted vector with columnar storage, i.e., the keys and the values are stored in separate arrays. In contrast to the
+// SortedVector, a search only touches the keys instead of the key-value pairs. The values are only gathered for the
+// found positions.
+// Every BLOCK_SIZE-th key is copied into a sparse top level. A search finds the block with a binary search on the
+// sparse keys and then counts the keys of the block that are less than the search key instead of branching on each
+// key, which allows the compiler to vectorize the scan.
+// The entries are sorted by key and value.
+template <typename Key, typename Value>
+class ColumnarSortedVector {
+ public:
+  static bool supports_key_duplicates() { return true; }
+
+  static bool supports(const IndexOperationType operation_type) {
+    switch (operation_type) {
+      case IndexOperationType::BulkLoad:
+        return false;
+      case IndexOperationType::BulkInsert:
+        return true;
+      case IndexOperationType::BulkErase:
+        return false;
+      case IndexOperationType::InsertEntry:
+        return true;
+      case IndexOperationType::EraseEntry:
+        return true;
+      case IndexOperationType::EqualityLookup:
+        return true;
+      case IndexOperationType::RangeLookup:
+        return true;
+    }
+  }
+
+  static bool supports_concurrent(const IndexOperationType operation_type) {
+    return operation_type == IndexOperationType::EqualityLookup || operation_type == IndexOperationType::RangeLookup;
+  }
+
+  static const std::string name() { return "Columnar Sorted Vector"; }
+
+  static IndexType type() { return IndexType::ColumnarSortedVector; }
+
+  void bulk_load(const Data<Key, Value>& data) { throw std::logic_error("Not supported."); }
+
+  void bulk_insert(const Data<Key, Value>& data) {
+    auto entries = std::vector<std::pair<Key, Value>>{};
+    entries.reserve(_keys.size() + data.entries().size());
+    for (size_t position = 0; position < _keys.size(); ++position) {
+      entries.emplace_back(_keys[position], _values[position]);
+    }
+    entries.insert(entries.end(), data.entries().cbegin(), data.entries().cend());
+    ParallelSort::sort(entries);
+
+    _keys.resize(entries.size());
+    _values.resize(entries.size());
+    ParallelSort::for_each_range(entries.size(), [&](const size_t begin, const size_t end) {
+      for (auto position = begin; position < end; ++position) {
+        _keys[position] = entries[position].first;
+        _values[position] = entries[position].second;
+      }
+    });
+    _build_sparse_keys();
+  }
+
+  void bulk_erase(const Data<Key, Value>& data) { throw std::logic_error("Not supported."); }
+
+  void insert(const Key& key, const Value& value) {
+    const auto position = _search(key, std::less_equal<Key>{});
+    _keys.insert(_keys.begin() + position, key);
+    _values.insert(_values.begin() + position, value);
+    _build_sparse_keys();
+  }
+
+  void erase(const Key& key, const Value& value) {
+    // reminder: we assume that the stored values are unique since they are tuple positions in a DBMS
+    for (auto position = _search(key, std::less<Key>{}); position < _keys.size() && _keys[position] == key;
+         ++position) {
+      if (_values[position] == value) {
+        _keys.erase(_keys.begin() + position);
+        _values.erase(_values.begin() + position);
+        _build_sparse_keys();
+        return;
+      }
+    }
+  }
+
+  std::vector<Value> equality_lookup(const Key& key) const { return range_lookup(key, key); }
+
+  void equality_lookup(const Key& key, std::vector<Value>& result) const { range_lookup(key, key, result); }
+
+  std::vector<Value> range_lookup(const Key& lower_bound_key, const Key& upper_bound_key) const {
+    auto result = std::vector<Value>{};
+    range_lookup(lower_bound_key, upper_bound_key, result);
+    return result;
+  }
+
+  void range_lookup(const Key& lower_bound_key, const Key& upper_bound_key, std::vector<Value>& result) const {
+    const auto begin = _search(lower_bound_key, std::less<Key>{});
+    const auto end = _search(upper_bound_key, std::less_equal<Key>{});
+    if (begin < end) {
+      result.insert(result.end(), _values.cbegin() + begin, _values.cbegin() + end);
+    }
+  }
+
+ protected:
+  static constexpr size_t BLOCK_SIZE = 64;
+
+  void _build_sparse_keys() {
+    _sparse_keys.clear();
+    _sparse_keys.reserve((_keys.size() + BLOCK_SIZE - 1) / BLOCK_SIZE);
+    for (size_t position = 0; position < _keys.size(); position += BLOCK_SIZE) {
+      _sparse_keys.push_back(_keys[position]);
+    }
+  }
+
+  // Returns the position of the first key for which compare(key, search_key) is false, i.e., the lower bound for
+  // std::less and the upper bound for std::less_equal. If the first sparse key for which compare is false belongs to
+  // block b, the searched position is within block b - 1 or it is the first position of block b.
+  template <typename Compare>
+  size_t _search(const Key& search_key, const Compare& compare) const {
+    const auto block = static_cast<size_t>(
+        std::partition_point(_sparse_keys.cbegin(), _sparse_keys.cend(),
+                             [&](const Key& sparse_key) { return compare(sparse_key, search_key); }) -
+        _sparse_keys.cbegin());
+    if (block == 0) {
+      return 0;
+    }
+
+    const auto* keys = _keys.data();
+    const auto block_begin = (block - 1) * BLOCK_SIZE;
+    const auto block_end = std::min(block_begin + BLOCK_SIZE, _keys.size());
+    auto count = size_t{0};
+#pragma omp simd reduction(+ : count)
+    for (auto position = block_begin; position < block_end; ++position) {
+      count += compare(keys[position], search_key) ? 1 : 0;
+    }
+    return block_begin + count;
+  }
+
+  std::vector<Key> _keys;
+  std::vector<Value> _values;
+  // the first key of each block of BLOCK_SIZE keys
+  std::vector<Key> _sparse_keys;
+};
+
+}  // namespace imib
@@ -0,0 +1,175 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "types.hpp"
+#include "utils/parallel_sort.hpp"
+
+namespace imib {
+
+// Cache-sensitive skip list (CSSL), see "Cache-Sensitive Skip List: Efficient Range Queries on Modern CPUs"
+// (IMDM 2016).
+// In contrast to a pointer-based skip list, the data lane and the fast lanes are stored as dense arrays. Each fast lane
+// contains every SKIP-th key of the lane below and the top lane contains at most SKIP keys. Thus, a search scans a
+// window of SKIP keys per lane. The scans count the keys that are less than the search key instead of branching on
+// each key, which allows the compiler to vectorize them.
+// The linked cssl library only stores uint32 keys without values. Thus, this is a re-implementation of its layout.
+// The entries of the data lane are sorted by key and value.
+template <typename Key, typename Value>
+class Cssl {
+ public:
+  static bool supports_key_duplicates() { return true; }
+
+  static bool supports(const IndexOperationType operation_type) {
+    switch (operation_type) {
+      case IndexOperationType::BulkLoad:
+        return true;
+      case IndexOperationType::BulkInsert:
+        return true;
+      case IndexOperationType::BulkErase:
+        return false;
+      case IndexOperationType::InsertEntry:
+        return true;
+      case IndexOperationType::EraseEntry:
+        return true;
+      case IndexOperationType::EqualityLookup:
+        return true;
+      case IndexOperationType::RangeLookup:
+        return true;
+    }
+  }
+
+  static bool supports_concurrent(const IndexOperationType operation_type) {
+    return operation_type == IndexOperationType::EqualityLookup || operation_type == IndexOperationType::RangeLookup;
+  }
+
+  static const std::string name() { return "CSSL"; }
+
+  static IndexType type() { return IndexType::CSSL; }
+
+  // the entries do not have to be sorted
+  void bulk_load(const Data<Key, Value>& data) {
+    _keys.clear();
+    _values.clear();
+    bulk_insert(data);
+  }
+
+  void bulk_insert(const Data<Key, Value>& data) {
+    auto entries = std::vector<std::pair<Key, Value>>{};
+    entries.reserve(_keys.size() + data.entries().size());
+    for (size_t position = 0; position < _keys.size(); ++position) {
+      entries.emplace_back(_keys[position], _values[position]);
+    }
+    entries.insert(entries.end(), data.entries().cbegin(), data.entries().cend());
+    ParallelSort::sort(entries);
+
+    _keys.resize(entries.size());
+    _values.resize(entries.size());
+    ParallelSort::for_each_range(entries.size(), [&](const size_t begin, const size_t end) {
+      for (auto position = begin; position < end; ++position) {
+        _keys[position] = entries[position].first;
+        _values[position] = entries[position].second;
+      }
+    });
+    _build_fast_lanes();
+  }
+
+  void bulk_erase(const Data<Key, Value>& data) { throw std::logic_error("Not supported."); }
+
+  // Inserts and erases shift the entries of the data lane and rebuild the fast lanes. Thus, they are only meant for
+  // small changes.
+  void insert(const Key& key, const Value& value) {
+    const auto position = _search(key, std::less_equal<Key>{});
+    _keys.insert(_keys.begin() + position, key);
+    _values.insert(_values.begin() + position, value);
+    _build_fast_lanes();
+  }
+
+  void erase(const Key& key, const Value& value) {
+    // reminder: we assume that the stored values are unique since they are tuple positions in a DBMS
+    for (auto position = _search(key, std::less<Key>{}); position < _keys.size() && _keys[position] == key;
+         ++position) {
+      if (_values[position] == value) {
+        _keys.erase(_keys.begin() + position);
+        _values.erase(_values.begin() + position);
+        _build_fast_lanes();
+        return;
+      }
+    }
+  }
+
+  std::vector<Value> equality_lookup(const Key& key) const { return range_lookup(key, key); }
+
+  void equality_lookup(const Key& key, std::vector<Value>& result) const { range_lookup(key, key, result); }
+
+  std::vector<Value> range_lookup(const Key& lower_bound_key, const Key& upper_bound_key) const {
+    auto result = std::vector<Value>{};
+    range_lookup(lower_bound_key, upper_bound_key, result);
+    return result;
+  }
+
+  void range_lookup(const Key& lower_bound_key, const Key& upper_bound_key, std::vector<Value>& result) const {
+    const auto begin = _search(lower_bound_key, std::less<Key>{});
+    const auto end = _search(upper_bound_key, std::less_equal<Key>{});
+    if (begin < end) {
+      result.insert(result.end(), _values.cbegin() + begin, _values.cbegin() + end);
+    }
+  }
+
+ protected:
+  static constexpr size_t SKIP = 8;
+
+  void _build_fast_lanes() {
+    _fast_lanes.clear();
+    const auto* lane = &_keys;
+    while (lane->size() > SKIP) {
+      auto fast_lane = std::vector<Key>{};
+      fast_lane.reserve((lane->size() + SKIP - 1) / SKIP);
+      for (size_t position = 0; position < lane->size(); position += SKIP) {
+        fast_lane.push_back((*lane)[position]);
+      }
+      _fast_lanes.push_back(std::move(fast_lane));
+      lane = &_fast_lanes.back();
+    }
+  }
+
+  // Returns the position of the first key in the data lane for which compare(key, search_key) is false, i.e., the
+  // lower bound for std::less and the upper bound for std::less_equal. The search starts at the top lane. If the
+  // position found in a fast lane is p, the searched position in the lane below is within the window of the SKIP keys
+  // following the key at position p - 1.
+  template <typename Compare>
+  size_t _search(const Key& search_key, const Compare& compare) const {
+    auto window_begin = size_t{0};
+    for (auto lane = _fast_lanes.crbegin(); lane != _fast_lanes.crend(); ++lane) {
+      const auto position = _scan_window(*lane, window_begin, search_key, compare);
+      window_begin = position > 0 ? (position - 1) * SKIP : 0;
+    }
+    return _scan_window(_keys, window_begin, search_key, compare);
+  }
+
+  template <typename Compare>
+  static size_t _scan_window(const std::vector<Key>& lane, const size_t window_begin, const Key& search_key,
+                             const Compare& compare) {
+    const auto* keys = lane.data();
+    const auto window_end = std::min(window_begin + SKIP, lane.size());
+    auto count = size_t{0};
+#pragma omp simd reduction(+ : count)
+    for (auto position = window_begin; position < window_end; ++position) {
+      count += compare(keys[position], search_key) ? 1 : 0;
+    }
+    return window_begin + count;
+  }
+
+  // the data lane
+  std::vector<Key> _keys;
+  std::vector<Value> _values;
+  // the fast lanes from the lowest to the top lane
+  std::vector<std::vector<Key>> _fast_lanes;
+};
+
+}  // namespace imib
@@ -0,0 +1,220 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "types.hpp"
+#include "utils/parallel_sort.hpp"
+
+namespace imib {
+
+// Static sorted array in Eytzinger layout, see "Array Layouts for Comparison-Based Searching" (JEA 2017).
+// The entries are stored in the order of a breadth-first traversal of a complete binary search tree, i.e., the children
+// of the entry at position k are at the positions 2k and 2k + 1 (position 0 is unused). In contrast to a binary search
+// on a sorted array, the first levels of the tree share few cache lines and the search is branch-free, which allows
+// prefetching the cache line that contains the descendants log2(64 / sizeof(Key)) levels below the current entry.
+// The entries are ordered by key and value. Range lookups start at the lower bound and visit the in-order successors.
+template <typename Key, typename Value>
+class EytzingerArray {
+ public:
+  static bool supports_key_duplicates() { return true; }
+
+  static bool supports(const IndexOperationType operation_type) {
+    switch (operation_type) {
+      case IndexOperationType::BulkLoad:
+        return true;
+      case IndexOperationType::BulkInsert:
+        return true;
+      case IndexOperationType::BulkErase:
+        return false;
+      case IndexOperationType::InsertEntry:
+        return true;
+      case IndexOperationType::EraseEntry:
+        return true;
+      case IndexOperationType::EqualityLookup:
+        return true;
+      case IndexOperationType::RangeLookup:
+        return true;
+    }
+  }
+
+  static bool supports_concurrent(const IndexOperationType operation_type) {
+    return operation_type == IndexOperationType::EqualityLookup || operation_type == IndexOperationType::RangeLookup;
+  }
+
+  static const std::string name() { return "Eytzinger Array"; }
+
+  static IndexType type() { return IndexType::EytzingerArray; }
+
+  // the entries do not have to be sorted
+  void bulk_load(const Data<Key, Value>& data) {
+    auto entries = data.entries();
+    ParallelSort::sort(entries);
+    _build(entries);
+  }
+
+  void bulk_insert(const Data<Key, Value>& data) {
+    auto inserted_entries = data.entries();
+    ParallelSort::sort(inserted_entries);
+    auto entries = _sorted_entries();
+    const auto middle = entries.insert(entries.end(), std::make_move_iterator(inserted_entries.begin()),
+                                       std::make_move_iterator(inserted_entries.end()));
+    ParallelSort::merge(entries, static_cast<size_t>(middle - entries.begin()));
+    _build(entries);
+  }
+
+  void bulk_erase(const Data<Key, Value>& data) { throw std::logic_error("Not supported."); }
+
+  // Inserts and erases rebuild the whole array. Thus, they are only meant for small changes.
+  void insert(const Key& key, const Value& value) {
+    auto entries = _sorted_entries();
+    const auto entry = std::pair<Key, Value>{key, value};
+    entries.insert(std::upper_bound(entries.begin(), entries.end(), entry), entry);
+    _build(entries);
+  }
+
+  void erase(const Key& key, const Value& value) {
+    auto entries = _sorted_entries();
+    const auto iter = std::lower_bound(entries.begin(), entries.end(), std::pair<Key, Value>{key, value});
+    // reminder: we assume that the stored values are unique since they are tuple positions in a DBMS
+    if (iter != entries.end() && iter->first == key && iter->second == value) {
+      entries.erase(iter);
+      _build(entries);
+    }
+  }
+
+  std::vector<Value> equality_lookup(const Key& key) const { return range_lookup(key, key); }
+
+  void equality_lookup(const Key& key, std::vector<Value>& result) const { range_lookup(key, key, result); }
+
+  std::vector<Value> range_lookup(const Key& lower_bound_key, const Key& upper_bound_key) const {
+    auto result = std::vector<Value>{};
+    range_lookup(lower_bound_key, upper_bound_key, result);
+    return result;
+  }
+
+  void range_lookup(const Key& lower_bound_key, const Key& upper_bound_key, std::vector<Value>& result) const {
+    for (auto position = _lower_bound(lower_bound_key); position != 0 && !(upper_bound_key < _keys[position]);
+         position = _successor(position)) {
+      result.emplace_back(_values[position]);
+    }
+  }
+
+  // Appends the values of all keys in the order of the keys. The descents of BATCH_GROUP_SIZE keys are interleaved
+  // level by level, thus, the cache misses of the group overlap.
+  void equality_lookup_batch(const std::span<const Key> keys, std::vector<Value>& result) const {
+    const auto* keys_data = _keys.data();
+    const auto size = _size();
+    size_t positions[BATCH_GROUP_SIZE];
+    for (size_t group_begin = 0; group_begin < keys.size(); group_begin += BATCH_GROUP_SIZE) {
+      const auto group = keys.subspan(group_begin, std::min(BATCH_GROUP_SIZE, keys.size() - group_begin));
+      std::fill(positions, positions + group.size(), size_t{1});
+      // the leaves of the complete tree are on the last two levels, thus, a descent may end one level earlier
+      for (auto level_begin = size_t{1}; level_begin <= size; level_begin *= 2) {
+        for (size_t index = 0; index < group.size(); ++index) {
+          const auto position = positions[index];
+          if (position <= size) {
+            __builtin_prefetch(keys_data + position * KEYS_PER_CACHE_LINE);
+            positions[index] = 2 * position + (keys_data[position] < group[index] ? 1 : 0);
+          }
+        }
+      }
+      for (size_t index = 0; index < group.size(); ++index) {
+        for (auto position = positions[index] >> __builtin_ffsll(static_cast<long long>(~positions[index]));
+             position != 0 && _keys[position] == group[index]; position = _successor(position)) {
+          result.emplace_back(_values[position]);
+        }
+      }
+    }
+  }
+
+ protected:
+  // the number of interleaved searches of equality_lookup_batch
+  static constexpr size_t BATCH_GROUP_SIZE = 16;
+
+  // the number of keys that fit into a cache line, i.e., the number of descendants 2^d of an entry d levels below it
+  static constexpr size_t KEYS_PER_CACHE_LINE = std::max(size_t{64} / sizeof(Key), size_t{1});
+
+  size_t _size() const { return _keys.empty() ? 0 : _keys.size() - 1; }
+
+  // Returns the position of the first entry whose key is not less than the search key or 0 if there is no such entry.
+  // The search descends to a leaf without branching on the comparison. The positions visited after the last left turn
+  // are the right turns, i.e., the trailing one bits of the final position. Removing them and the bit of the left turn
+  // yields the lower bound.
+  size_t _lower_bound(const Key& search_key) const {
+    const auto* keys = _keys.data();
+    const auto size = _size();
+    auto position = size_t{1};
+    while (position <= size) {
+      __builtin_prefetch(keys + position * KEYS_PER_CACHE_LINE);
+      position = 2 * position + (keys[position] < search_key ? 1 : 0);
+    }
+    return position >> __builtin_ffsll(static_cast<long long>(~position));
+  }
+
+  // returns the position of the in-order successor or 0 if the entry at the given position is the last one
+  size_t _successor(size_t position) const {
+    const auto size = _size();
+    if (2 * position + 1 <= size) {
+      // the leftmost entry of the right subtree
+      position = 2 * position + 1;
+      while (2 * position <= size) {
+        position = 2 * position;
+      }
+      return position;
+    }
+    // the first ancestor whose left subtree contains the entry
+    return position >> __builtin_ffsll(static_cast<long long>(~position));
+  }
+
+  // Returns the position of the entry with the given in-order rank (starting at 0) in a layout of size entries. The
+  // tree is complete, i.e., only the last level may lack entries on its right side. In the perfect tree of the same
+  // height, the entry of the 1-based in-order rank r is on the level ctz(r) above the leaves at the position
+  // (2^height + r) >> (ctz(r) + 1). Its leaves have the odd ranks, thus, the first 2 * last_level_size ranks of the
+  // complete tree are the same in the perfect tree, while the remaining entries are inner entries and skip the missing
+  // leaves in between them.
+  static size_t _position(const size_t rank, const size_t size) {
+    const auto height = static_cast<size_t>(std::bit_width(size));
+    const auto last_level_size = size - ((size_t{1} << (height - 1)) - 1);
+    const auto in_order_rank = rank + 1 <= 2 * last_level_size ? rank + 1 : 2 * (rank + 1) - 2 * last_level_size;
+    return ((size_t{1} << height) + in_order_rank) >> (std::countr_zero(in_order_rank) + 1);
+  }
+
+  // builds the layout from the entries sorted by key and value, each thread moves a range of them to their positions
+  void _build(const std::vector<std::pair<Key, Value>>& entries) {
+    const auto size = entries.size();
+    _keys.assign(size + 1, Key{});
+    _values.assign(size + 1, Value{});
+    ParallelSort::for_each_range(size, [&](const size_t begin, const size_t end) {
+      for (auto rank = begin; rank < end; ++rank) {
+        const auto position = _position(rank, size);
+        _keys[position] = entries[rank].first;
+        _values[position] = entries[rank].second;
+      }
+    });
+  }
+
+  // returns the entries sorted by key and value
+  std::vector<std::pair<Key, Value>> _sorted_entries() const {
+    const auto size = _size();
+    auto entries = std::vector<std::pair<Key, Value>>(size);
+    ParallelSort::for_each_range(size, [&](const size_t begin, const size_t end) {
+      for (auto rank = begin; rank < end; ++rank) {
+        const auto position = _position(rank, size);
+        entries[rank] = {_keys[position], _values[position]};
+      }
+    });
+    return entries;
+  }
+
+  std::vector<Key> _keys;
+  std::vector<Value> _values;
+};
+
+}  // namespace imib
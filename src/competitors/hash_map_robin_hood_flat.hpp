@@ -6,6 +6,8 @@
 
 #include "robin_hood.h"  // NOLINT
 
+#include "utils/hash_map_shrinking.hpp"
+
 // supports: only unique keys, no support for key duplicates
 
 namespace imib {
@@ -22,7 +24,7 @@ class HashMapRobinHoodFlat {
       case IndexOperationType::BulkInsert:
         return true;
       case IndexOperationType::BulkErase:
-        return false;
+        return true;
       case IndexOperationType::InsertEntry:
         return true;
       case IndexOperationType::EraseEntry:
@@ -34,26 +36,40 @@ class HashMapRobinHoodFlat {
     }
   }
 
+  static bool supports_concurrent(const IndexOperationType operation_type) {
+    return operation_type == IndexOperationType::EqualityLookup || operation_type == IndexOperationType::RangeLookup;
+  }
+
   static const std::string name() { return "RH Flat Map"; }
 
   static IndexType type() { return IndexType::RobinHoodFlatMap; }
 
   void bulk_load(const Data<Key, Value>& data) { throw std::logic_error("Not supported."); }
 
-  void bulk_insert(const Data<Key, Value>& data) { _map.insert(data.entries.cbegin(), data.entries.cend()); }
+  void bulk_insert(const Data<Key, Value>& data) { _map.insert(data.entries().cbegin(), data.entries().cend()); }
 
-  void bulk_erase(const Data<Key, Value>& data) { throw std::logic_error("Not supported."); }
+  // erases the keys one by one, then shrinks the table, see HashMapShrinking
+  void bulk_erase(const Data<Key, Value>& data) {
+    for (const auto& entry : data.entries()) {
+      _map.erase(entry.first);
+    }
+    HashMapShrinking::shrink_after_bulk_erase(_map);
+  }
 
   void insert(const Key& key, const Value& value) { _map.insert({key, value}); }
 
   void erase(const Key& key, const Value& value) { _map.erase(key); }
 
   std::vector<Value> equality_lookup(const Key& key) const {
-    const auto result = _map.find(key);
-    if (result != _map.cend()) {
-      return std::vector<Value>{result->second};
-    } else {
-      return std::vector<Value>{};
+    auto result = std::vector<Value>{};
+    equality_lookup(key, result);
+    return result;
+  }
+
+  void equality_lookup(const Key& key, std::vector<Value>& result) const {
+    const auto found = _map.find(key);
+    if (found != _map.cend()) {
+      result.emplace_back(found->second);
     }
   }
 
@@ -61,6 +77,10 @@ class HashMapRobinHoodFlat {
     throw std::logic_error("Not supported.");
   }
 
+  void range_lookup(const Key& lower_bound_key, const Key& upper_bound_key, std::vector<Value>& result) const {
+    throw std::logic_error("Not supported.");
+  }
+
  protected:
   robin_hood::unordered_flat_map<Key, Value> _map;
 };
@@ -0,0 +1,100 @@
+#pragma once
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "robin_hood.h"  // NOLINT
+
+#include "types.hpp"
+
+// supports key duplicates: each key maps to a posting list of its values in the order they were inserted
+
+namespace imib {
+
+template <typename Key, typename Value>
+class HashMapRobinHoodPostingList {
+ public:
+  static bool supports_key_duplicates() { return true; }
+
+  static bool supports(const IndexOperationType operation_type) {
+    switch (operation_type) {
+      case IndexOperationType::BulkLoad:
+        return false;
+      case IndexOperationType::BulkInsert:
+        return true;
+      case IndexOperationType::BulkErase:
+        return false;
+      case IndexOperationType::InsertEntry:
+        return true;
+      case IndexOperationType::EraseEntry:
+        return true;
+      case IndexOperationType::EqualityLookup:
+        return true;
+      case IndexOperationType::RangeLookup:
+        return false;
+    }
+  }
+
+  static bool supports_concurrent(const IndexOperationType operation_type) {
+    return operation_type == IndexOperationType::EqualityLookup || operation_type == IndexOperationType::RangeLookup;
+  }
+
+  static const std::string name() { return "RH Posting List Map"; }
+
+  static IndexType type() { return IndexType::RobinHoodPostingListMap; }
+
+  void bulk_load(const Data<Key, Value>& data) { throw std::logic_error("Not supported."); }
+
+  void bulk_insert(const Data<Key, Value>& data) {
+    for (const auto& entry : data.entries()) {
+      insert(entry.first, entry.second);
+    }
+  }
+
+  void bulk_erase(const Data<Key, Value>& data) { throw std::logic_error("Not supported."); }
+
+  void insert(const Key& key, const Value& value) { _map[key].push_back(value); }
+
+  // erases only the entry with the given value, the key is erased with its last value
+  void erase(const Key& key, const Value& value) {
+    const auto found = _map.find(key);
+    if (found == _map.end()) {
+      return;
+    }
+    auto& posting_list = found->second;
+    const auto position = std::find(posting_list.begin(), posting_list.end(), value);
+    if (position != posting_list.end()) {
+      posting_list.erase(position);
+    }
+    if (posting_list.empty()) {
+      _map.erase(found);
+    }
+  }
+
+  std::vector<Value> equality_lookup(const Key& key) const {
+    auto result = std::vector<Value>{};
+    equality_lookup(key, result);
+    return result;
+  }
+
+  void equality_lookup(const Key& key, std::vector<Value>& result) const {
+    const auto found = _map.find(key);
+    if (found != _map.cend()) {
+      result.insert(result.end(), found->second.cbegin(), found->second.cend());
+    }
+  }
+
+  std::vector<Value> range_lookup(const Key& lower_bound_key, const Key& upper_bound_key) const {
+    throw std::logic_error("Not supported.");
+  }
+
+  void range_lookup(const Key& lower_bound_key, const Key& upper_bound_key, std::vector<Value>& result) const {
+    throw std::logic_error("Not supported.");
+  }
+
+ protected:
+  robin_hood::unordered_flat_map<Key, std::vector<Value>> _map;
+};
+
+}  // namespace imib
@@ -37,6 +37,11 @@ class Judy {
     }
   }
 
+  static bool supports_concurrent(const IndexOperationType operation_type) {
+    // even lookups are not thread-safe since judyLArray stores the state of the last search (see success())
+    return false;
+  }
+
   static const std::string name() { return "MP Judy"; }
 
   static IndexType type() { return IndexType::JudyArray; }
@@ -53,11 +58,15 @@ class Judy {
   void erase(const Key& key, const Value& value) { _judy.removeEntry(key); }
 
   std::vector<Value> equality_lookup(const Key& key) {
-    const auto result = _judy.find(key);
+    auto result = std::vector<Value>{};
+    equality_lookup(key, result);
+    return result;
+  }
+
+  void equality_lookup(const Key& key, std::vector<Value>& result) {
+    const auto found = _judy.find(key);
     if (_judy.success()) {
-      return std::vector<Value>{result};
-    } else {
-      return std::vector<Value>{};
+      result.emplace_back(found);
     }
   }
 
@@ -66,6 +75,10 @@ class Judy {
     throw std::logic_error("Not supported.");
   }
 
+  void range_lookup(const Key& lower_bound_key, const Key& upper_bound_key, std::vector<Value>& result) const {
+    throw std::logic_error("Not supported.");
+  }
+
  protected:
   judyLArray<Key, Value> _judy;
 };
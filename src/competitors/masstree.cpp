@@ -0,0 +1,82 @@
+#include "masstree.hpp"
+
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+// masstree declares the following global variables as extern and expects the application to define them
+volatile mrcu_epoch_type active_epoch = 1;
+volatile mrcu_epoch_type globalepoch = 1;
+volatile bool recovering = false;
+
+namespace imib {
+
+namespace {
+
+// Masstree cannot free a threadinfo, thus, the threadinfos are pooled and reused by the threads of later executions.
+// A thread leases the threadinfo with the smallest free worker id on its first Masstree operation and returns it when
+// it exits. Thus, there are at most as many threadinfos as threads were running at the same time.
+struct ThreadInfoPool {
+  std::mutex mutex;
+  std::vector<threadinfo*> thread_infos;  // indexed by the worker id
+  std::vector<bool> leased;
+};
+
+ThreadInfoPool& thread_info_pool() {
+  static auto pool = ThreadInfoPool{};
+  return pool;
+}
+
+struct ThreadInfoLease {
+  ThreadInfoLease() {
+    auto& pool = thread_info_pool();
+    const auto lock = std::lock_guard<std::mutex>{pool.mutex};
+    while (worker_id < pool.leased.size() && pool.leased[worker_id]) {
+      ++worker_id;
+    }
+    if (worker_id == pool.thread_infos.size()) {
+      pool.thread_infos.push_back(threadinfo::make(threadinfo::TI_PROCESS, static_cast<int>(worker_id)));
+      pool.leased.push_back(false);
+    }
+    pool.leased[worker_id] = true;
+    thread_info = pool.thread_infos[worker_id];
+    thread_info->rcu_start();
+  }
+
+  ~ThreadInfoLease() {
+    auto& pool = thread_info_pool();
+    const auto lock = std::lock_guard<std::mutex>{pool.mutex};
+    // an inactive threadinfo does not hold back the epoch, its remaining garbage is freed by masstree_reclaim
+    thread_info->rcu_stop();
+    pool.leased[worker_id] = false;
+  }
+
+  size_t worker_id = 0;
+  threadinfo* thread_info = nullptr;
+};
+
+thread_local auto thread_info_lease = ThreadInfoLease{};
+
+}  // namespace
+
+threadinfo& masstree_thread_info() { return *thread_info_lease.thread_info; }
+
+void masstree_reclaim() {
+  auto& calling_thread_info = masstree_thread_info();
+  auto& pool = thread_info_pool();
+  const auto lock = std::lock_guard<std::mutex>{pool.mutex};
+  globalepoch = globalepoch + 2;
+  // the calling thread is between two operations, thus, it enters the new epoch before the active epoch is computed
+  calling_thread_info.rcu_start();
+  active_epoch = threadinfo::min_active_epoch();
+  for (size_t worker_id = 0; worker_id < pool.thread_infos.size(); ++worker_id) {
+    auto* thread_info = pool.thread_infos[worker_id];
+    if (thread_info == &calling_thread_info) {
+      thread_info->rcu_quiesce();
+    } else if (!pool.leased[worker_id]) {
+      thread_info->rcu_stop();
+    }
+  }
+}
+
+}  // namespace imib
@@ -0,0 +1,181 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+// config.h is generated by masstree's configure script and has to be included before any other masstree header
+#include "config.h"  // NOLINT
+
+#include "compiler.hh"
+#include "kvthread.hh"
+#include "masstree.hh"
+#include "masstree_insert.hh"
+#include "masstree_print.hh"
+#include "masstree_remove.hh"
+#include "masstree_scan.hh"
+#include "masstree_tcursor.hh"
+#include "string.hh"
+
+#include "types.hpp"
+#include "utils/key_encoding.hpp"
+
+// supports: only unique keys, no support for key duplicates
+
+namespace imib {
+
+// Masstree requires a threadinfo per thread for its memory allocation and epoch-based memory reclamation. Returns the
+// threadinfo of the calling thread, which is leased from a pool of reused threadinfos on the first call.
+threadinfo& masstree_thread_info();
+
+// Advances the epoch and frees the memory that the threadinfos of the finished threads and of the calling thread
+// retired in earlier epochs, e.g., the erased nodes. Masstree leaves advancing the epoch to the application, thus, it
+// is advanced by the thread that drives the benchmark after each measured phase. Must not be called while the calling
+// thread is within an operation.
+void masstree_reclaim();
+
+struct MasstreeParameters : public ::Masstree::nodeparams<15, 15> {
+  // values are stored as uint64_t, which also holds values of smaller unsigned integer types
+  typedef uint64_t value_type;
+  typedef ::Masstree::value_print<value_type> value_print_type;
+  typedef threadinfo threadinfo_type;
+};
+
+// Masstree is a trie of B+ trees, each indexing a key slice of 8 bytes, see
+// https://pdos.csail.mit.edu/papers/masstree:eurosys12.pdf
+// All supported operations can be executed concurrently.
+template <typename Key, typename Value>
+class Masstree {
+  static_assert(std::is_arithmetic_v<Key>, "Masstree is only supported for fixed-length keys.");
+
+ public:
+  static bool supports_key_duplicates() { return false; }
+
+  static bool supports(const IndexOperationType operation_type) {
+    switch (operation_type) {
+      case IndexOperationType::BulkLoad:
+        return false;
+      case IndexOperationType::BulkInsert:
+        return false;
+      case IndexOperationType::BulkErase:
+        return false;
+      case IndexOperationType::InsertEntry:
+        return true;
+      case IndexOperationType::EraseEntry:
+        return true;
+      case IndexOperationType::EqualityLookup:
+        return true;
+      case IndexOperationType::RangeLookup:
+        return true;
+    }
+  }
+
+  static bool supports_concurrent(const IndexOperationType operation_type) { return supports(operation_type); }
+
+  Masstree() { _table.initialize(masstree_thread_info()); }
+
+  ~Masstree() {
+    _table.destroy(masstree_thread_info());
+    masstree_reclaim();
+  }
+
+  static const std::string name() { return "Masstree"; }
+
+  static IndexType type() { return IndexType::Masstree; }
+
+  // frees the memory of the erased entries, see masstree_reclaim
+  void reclaim() { masstree_reclaim(); }
+
+  void bulk_load(const Data<Key, Value>& data) { throw std::logic_error("Not supported."); }
+
+  void bulk_insert(const Data<Key, Value>& data) { throw std::logic_error("Not supported."); }
+
+  void bulk_erase(const Data<Key, Value>& data) { throw std::logic_error("Not supported."); }
+
+  void insert(const Key& key, const Value& value) {
+    auto& thread_info = masstree_thread_info();
+    const auto encoded_key = EncodedKey{key};
+    auto cursor = ::Masstree::tcursor<MasstreeParameters>{_table, encoded_key.str()};
+    if (!cursor.find_insert(thread_info)) {
+      cursor.value() = value;
+      fence();
+    }
+    cursor.finish(1, thread_info);
+  }
+
+  void erase(const Key& key, const Value& value) {
+    auto& thread_info = masstree_thread_info();
+    const auto encoded_key = EncodedKey{key};
+    auto cursor = ::Masstree::tcursor<MasstreeParameters>{_table, encoded_key.str()};
+    const auto found = cursor.find_locked(thread_info);
+    cursor.finish(found ? -1 : 0, thread_info);
+  }
+
+  std::vector<Value> equality_lookup(const Key& key) const {
+    auto result = std::vector<Value>{};
+    equality_lookup(key, result);
+    return result;
+  }
+
+  void equality_lookup(const Key& key, std::vector<Value>& result) const {
+    const auto encoded_key = EncodedKey{key};
+    auto cursor = ::Masstree::unlocked_tcursor<MasstreeParameters>{_table, encoded_key.str()};
+    if (cursor.find_unlocked(masstree_thread_info())) {
+      result.emplace_back(static_cast<Value>(cursor.value()));
+    }
+  }
+
+  std::vector<Value> range_lookup(const Key& lower_bound_key, const Key& upper_bound_key) const {
+    auto result = std::vector<Value>{};
+    range_lookup(lower_bound_key, upper_bound_key, result);
+    return result;
+  }
+
+  void range_lookup(const Key& lower_bound_key, const Key& upper_bound_key, std::vector<Value>& result) const {
+    auto scanner = RangeScanner{upper_bound_key, result};
+    const auto encoded_key = EncodedKey{lower_bound_key};
+    _table.scan(encoded_key.str(), true, scanner, masstree_thread_info());
+  }
+
+ protected:
+  // Masstree compares keys byte-wise. Thus, keys are encoded binary-comparable to preserve their order (see
+  // KeyEncoding).
+  struct EncodedKey {
+    uint8_t bytes[sizeof(Key)];
+
+    explicit EncodedKey(const Key& key) { KeyEncoding::encode(key, bytes); }
+
+    ::Masstree::Str str() const {
+      return ::Masstree::Str{reinterpret_cast<const char*>(bytes), static_cast<int>(sizeof(Key))};
+    }
+
+    static Key decode(const ::Masstree::Str& str) {
+      return KeyEncoding::decode<Key>(reinterpret_cast<const uint8_t*>(str.data()));
+    }
+  };
+
+  // visits the entries in ascending key order, starting at the lower bound key
+  struct RangeScanner {
+    Key upper_bound_key;
+    std::vector<Value>& result;
+
+    template <typename Stack, typename LeafKey>
+    void visit_leaf(const Stack&, const LeafKey&, threadinfo&) {
+      // do nothing
+    }
+
+    bool visit_value(::Masstree::Str key, const MasstreeParameters::value_type value, threadinfo&) {
+      if (EncodedKey::decode(key) > upper_bound_key) {
+        return false;
+      }
+      result.push_back(static_cast<Value>(value));
+      return true;
+    }
+  };
+
+  ::Masstree::basic_table<MasstreeParameters> _table;
+};
+
+}  // namespace imib
@@ -0,0 +1,221 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "types.hpp"
+#include "utils/parallel_sort.hpp"
+
+namespace imib {
+
+// Learned index with an error-bounded piecewise linear approximation (PLA) of the position of the keys in a sorted
+// array, see "The PGM-index: a fully-dynamic compressed learned index with provable worst-case bounds" (VLDB 2020) and
+// "FITing-Tree: A Data-aware Index Structure" (SIGMOD 2019).
+// Each segment predicts the position of the first entry with a given key with an error of at most EPSILON positions.
+// The segments are built in one pass with the shrinking cone algorithm of the FITing-Tree. A lookup searches the
+// segment by its first key, predicts the position, and searches the lower bound in the window of 2 * EPSILON + 1
+// positions around the prediction (last-mile search). The model only consists of the segments, which are allocated on
+// the heap, thus, their memory is included in the index size measured with the MemoryTracker.
+// The entries are sorted by key and value.
+template <typename Key, typename Value>
+class PiecewiseLinearIndex {
+ public:
+  static bool supports_key_duplicates() { return true; }
+
+  static bool supports(const IndexOperationType operation_type) {
+    switch (operation_type) {
+      case IndexOperationType::BulkLoad:
+        return true;
+      case IndexOperationType::BulkInsert:
+        return true;
+      case IndexOperationType::BulkErase:
+        return false;
+      case IndexOperationType::InsertEntry:
+        return true;
+      case IndexOperationType::EraseEntry:
+        return true;
+      case IndexOperationType::EqualityLookup:
+        return true;
+      case IndexOperationType::RangeLookup:
+        return true;
+    }
+  }
+
+  static bool supports_concurrent(const IndexOperationType operation_type) {
+    return operation_type == IndexOperationType::EqualityLookup || operation_type == IndexOperationType::RangeLookup;
+  }
+
+  static const std::string name() { return "PLA Index"; }
+
+  static IndexType type() { return IndexType::PiecewiseLinearIndex; }
+
+  // the entries do not have to be sorted
+  void bulk_load(const Data<Key, Value>& data) {
+    _keys.clear();
+    _values.clear();
+    bulk_insert(data);
+  }
+
+  void bulk_insert(const Data<Key, Value>& data) {
+    auto entries = std::vector<std::pair<Key, Value>>{};
+    entries.reserve(_keys.size() + data.entries().size());
+    for (size_t position = 0; position < _keys.size(); ++position) {
+      entries.emplace_back(_keys[position], _values[position]);
+    }
+    entries.insert(entries.end(), data.entries().cbegin(), data.entries().cend());
+    ParallelSort::sort(entries);
+
+    _keys.resize(entries.size());
+    _values.resize(entries.size());
+    ParallelSort::for_each_range(entries.size(), [&](const size_t begin, const size_t end) {
+      for (auto position = begin; position < end; ++position) {
+        _keys[position] = entries[position].first;
+        _values[position] = entries[position].second;
+      }
+    });
+    _build_segments();
+  }
+
+  void bulk_erase(const Data<Key, Value>& data) { throw std::logic_error("Not supported."); }
+
+  // Inserts and erases shift the entries and rebuild the model. Thus, they are only meant for small changes.
+  void insert(const Key& key, const Value& value) {
+    auto position = _upper_bound(key);
+    _keys.insert(_keys.begin() + position, key);
+    _values.insert(_values.begin() + position, value);
+    _build_segments();
+  }
+
+  void erase(const Key& key, const Value& value) {
+    // reminder: we assume that the stored values are unique since they are tuple positions in a DBMS
+    for (auto position = _lower_bound(key); position < _keys.size() && _keys[position] == key; ++position) {
+      if (_values[position] == value) {
+        _keys.erase(_keys.begin() + position);
+        _values.erase(_values.begin() + position);
+        _build_segments();
+        return;
+      }
+    }
+  }
+
+  std::vector<Value> equality_lookup(const Key& key) const { return range_lookup(key, key); }
+
+  void equality_lookup(const Key& key, std::vector<Value>& result) const { range_lookup(key, key, result); }
+
+  std::vector<Value> range_lookup(const Key& lower_bound_key, const Key& upper_bound_key) const {
+    auto result = std::vector<Value>{};
+    range_lookup(lower_bound_key, upper_bound_key, result);
+    return result;
+  }
+
+  void range_lookup(const Key& lower_bound_key, const Key& upper_bound_key, std::vector<Value>& result) const {
+    for (auto position = _lower_bound(lower_bound_key);
+         position < _keys.size() && !(upper_bound_key < _keys[position]); ++position) {
+      result.emplace_back(_values[position]);
+    }
+  }
+
+ protected:
+  static constexpr size_t EPSILON = 64;
+
+  // position(key) = first_position + slope * (key - first_key)
+  struct Segment {
+    double slope;
+    size_t first_position;
+  };
+
+  // Shrinking cone: the cone of the slopes that predict all positions of the segment with an error of at most EPSILON
+  // is narrowed by each key. If the cone becomes empty, the key starts a new segment. Only the first position of each
+  // distinct key is modeled. Since the lower slope limit is at least 0, the predictions are monotone.
+  void _build_segments() {
+    _segment_keys.clear();
+    _segments.clear();
+    const auto epsilon = static_cast<double>(EPSILON);
+    auto min_slope = 0.0;
+    auto max_slope = std::numeric_limits<double>::infinity();
+    for (size_t position = 0; position < _keys.size(); ++position) {
+      if (position > 0 && _keys[position] == _keys[position - 1]) {
+        continue;
+      }
+      if (!_segment_keys.empty()) {
+        const auto key_distance = static_cast<double>(_keys[position] - _segment_keys.back());
+        const auto position_distance = static_cast<double>(position - _segments.back().first_position);
+        const auto segment_min_slope = std::max(min_slope, (position_distance - epsilon) / key_distance);
+        const auto segment_max_slope = std::min(max_slope, (position_distance + epsilon) / key_distance);
+        if (segment_min_slope <= segment_max_slope) {
+          min_slope = segment_min_slope;
+          max_slope = segment_max_slope;
+          _segments.back().slope = max_slope == std::numeric_limits<double>::infinity() ? 0.0
+                                                                                        : (min_slope + max_slope) / 2;
+          continue;
+        }
+      }
+      _segment_keys.push_back(_keys[position]);
+      _segments.push_back(Segment{0.0, position});
+      min_slope = 0.0;
+      max_slope = std::numeric_limits<double>::infinity();
+    }
+  }
+
+  // returns the position of the first entry whose key is not less than the search key
+  size_t _lower_bound(const Key& search_key) const {
+    if (_segment_keys.empty()) {
+      return 0;
+    }
+    // the last segment whose first key is not greater than the search key
+    const auto segment_iter = std::upper_bound(_segment_keys.cbegin(), _segment_keys.cend(), search_key);
+    if (segment_iter == _segment_keys.cbegin()) {
+      return 0;
+    }
+    const auto segment_index = static_cast<size_t>(segment_iter - _segment_keys.cbegin()) - 1;
+    const auto& segment = _segments[segment_index];
+
+    // the lower bound is not before the first position of the segment and not after the first position of the next one
+    const auto segment_end =
+        segment_index + 1 < _segments.size() ? _segments[segment_index + 1].first_position : _keys.size();
+    // the search key is not less than the segment's first key, thus, the prediction is not less than its first position
+    const auto offset = std::min(segment.slope * static_cast<double>(search_key - _segment_keys[segment_index]),
+                                 static_cast<double>(segment_end - segment.first_position));
+    const auto prediction = segment.first_position + static_cast<size_t>(offset);
+    const auto window_begin = std::max(segment.first_position, prediction > EPSILON ? prediction - EPSILON : 0);
+    const auto window_end = std::min(segment_end, prediction + EPSILON + 1);
+
+    // The model bounds the error for the keys of the segment. The lower bound of a search key that is not stored is
+    // the position of the next stored key, which may be outside of the window. Thus, the search continues outside of
+    // the window if the lower bound is at its border.
+    const auto keys_begin = _keys.cbegin();
+    if (window_begin > segment.first_position && !(_keys[window_begin - 1] < search_key)) {
+      return static_cast<size_t>(
+          std::lower_bound(keys_begin + segment.first_position, keys_begin + window_begin, search_key) - keys_begin);
+    }
+    const auto position = static_cast<size_t>(
+        std::lower_bound(keys_begin + window_begin, keys_begin + window_end, search_key) - keys_begin);
+    if (position == window_end && window_end < segment_end) {
+      return static_cast<size_t>(
+          std::lower_bound(keys_begin + window_end, keys_begin + segment_end, search_key) - keys_begin);
+    }
+    return position;
+  }
+
+  // returns the position of the first entry whose key is greater than the search key
+  size_t _upper_bound(const Key& search_key) const {
+    auto position = _lower_bound(search_key);
+    while (position < _keys.size() && _keys[position] == search_key) {
+      ++position;
+    }
+    return position;
+  }
+
+  std::vector<Key> _keys;
+  std::vector<Value> _values;
+  // the first key of each segment, separated from the models to search them compactly
+  std::vector<Key> _segment_keys;
+  std::vector<Segment> _segments;
+};
+
+}  // namespace imib
@@ -0,0 +1,142 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <shared_mutex>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "types.hpp"
+
+// supports: only unique keys, no support for key duplicates
+
+namespace imib {
+
+// Thread-safe hash map that partitions the entries by the key's hash into a fixed number of shards. Each shard is an
+// unsynchronized hash map competitor protected by its own reader-writer lock. Lookups take the shared lock and
+// modifications the exclusive lock of the key's shard, thus, only operations on the same shard block each other.
+template <template <typename, typename> class HashMap, typename Key, typename Value>
+class ShardedHashMap {
+ public:
+  static bool supports_key_duplicates() { return false; }
+
+  static bool supports(const IndexOperationType operation_type) {
+    switch (operation_type) {
+      case IndexOperationType::BulkLoad:
+        return false;
+      case IndexOperationType::BulkInsert:
+        return true;
+      case IndexOperationType::BulkErase:
+        return false;
+      case IndexOperationType::InsertEntry:
+        return true;
+      case IndexOperationType::EraseEntry:
+        return true;
+      case IndexOperationType::EqualityLookup:
+        return true;
+      case IndexOperationType::RangeLookup:
+        return false;
+    }
+  }
+
+  static bool supports_concurrent(const IndexOperationType operation_type) { return supports(operation_type); }
+
+  static const std::string name() { return "Sharded " + HashMap<Key, Value>::name(); }
+
+  static IndexType type() { return IndexType::ShardedHashMap; }
+
+  void bulk_load(const Data<Key, Value>& data) { throw std::logic_error("Not supported."); }
+
+  void bulk_insert(const Data<Key, Value>& data) {
+    for (const auto& entry : data.entries()) {
+      insert(entry.first, entry.second);
+    }
+  }
+
+  void bulk_erase(const Data<Key, Value>& data) { throw std::logic_error("Not supported."); }
+
+  void insert(const Key& key, const Value& value) {
+    auto& shard = _shard(key);
+    const auto lock = std::unique_lock{shard.mutex};
+    shard.map.insert(key, value);
+  }
+
+  void erase(const Key& key, const Value& value) {
+    auto& shard = _shard(key);
+    const auto lock = std::unique_lock{shard.mutex};
+    shard.map.erase(key, value);
+  }
+
+  std::vector<Value> equality_lookup(const Key& key) const {
+    auto result = std::vector<Value>{};
+    equality_lookup(key, result);
+    return result;
+  }
+
+  void equality_lookup(const Key& key, std::vector<Value>& result) const {
+    const auto& shard = _shard(key);
+    const auto lock = std::shared_lock{shard.mutex};
+    shard.map.equality_lookup(key, result);
+  }
+
+  // Appends the values of all keys in the order of the keys. The shards of a group of BATCH_GROUP_SIZE keys are
+  // selected and prefetched first, then each key is looked up in its shard. Thus, the cache misses of the shard locks
+  // and the map headers of the group overlap. The maps of the shards do not expose their buckets, thus, the lookups
+  // within the shards are not interleaved.
+  void equality_lookup_batch(const std::span<const Key> keys, std::vector<Value>& result) const {
+    size_t shard_ids[BATCH_GROUP_SIZE];
+    for (size_t group_begin = 0; group_begin < keys.size(); group_begin += BATCH_GROUP_SIZE) {
+      const auto group = keys.subspan(group_begin, std::min(BATCH_GROUP_SIZE, keys.size() - group_begin));
+      for (size_t index = 0; index < group.size(); ++index) {
+        shard_ids[index] = _shard_id(group[index]);
+        __builtin_prefetch(&_shards[shard_ids[index]]);
+      }
+      for (size_t index = 0; index < group.size(); ++index) {
+        const auto& shard = _shards[shard_ids[index]];
+        const auto lock = std::shared_lock{shard.mutex};
+        shard.map.equality_lookup(group[index], result);
+      }
+    }
+  }
+
+  std::vector<Value> range_lookup(const Key& lower_bound_key, const Key& upper_bound_key) const {
+    throw std::logic_error("Not supported.");
+  }
+
+  void range_lookup(const Key& lower_bound_key, const Key& upper_bound_key, std::vector<Value>& result) const {
+    throw std::logic_error("Not supported.");
+  }
+
+ protected:
+  static constexpr size_t SHARD_COUNT_BITS = 6;
+
+  // the number of keys of equality_lookup_batch whose shards are prefetched together
+  static constexpr size_t BATCH_GROUP_SIZE = 16;
+
+  // aligned to a cache line to avoid false sharing of the locks
+  struct alignas(64) Shard {
+    mutable std::shared_mutex mutex;
+    HashMap<Key, Value> map;
+  };
+
+  // std::hash is the identity for integers on common implementations. Thus, the hash is multiplied with the 64-bit
+  // golden ratio (Fibonacci hashing) and the shard is taken from the high bits, which depend on all key bits. The
+  // sharded hash maps themselves use the low bits of their own hash.
+  static size_t _shard_id(const Key& key) {
+    const auto hash = static_cast<uint64_t>(std::hash<Key>{}(key));
+    return static_cast<size_t>((hash * 0x9E3779B97F4A7C15ull) >> (64 - SHARD_COUNT_BITS));
+  }
+
+  Shard& _shard(const Key& key) { return _shards[_shard_id(key)]; }
+
+  const Shard& _shard(const Key& key) const { return _shards[_shard_id(key)]; }
+
+  std::array<Shard, size_t{1} << SHARD_COUNT_BITS> _shards;
+};
+
+}  // namespace imib
@@ -0,0 +1,116 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "types.hpp"
+#include "utils/parallel_sort.hpp"
+#include "utils/simd_search.hpp"
+
+namespace imib {
+
+// Sorted vector whose searches use the k-ary SIMD search of SimdSearch. The instruction set (AVX-512, AVX2, or the
+// scalar std::lower_bound as fallback) is selected at runtime. Like the ColumnarSortedVector, the keys and the values
+// are stored in separate arrays, since the SIMD instructions load consecutive keys.
+// The entries are sorted by key and value.
+template <typename Key, typename Value>
+class SimdSortedVector {
+ public:
+  static bool supports_key_duplicates() { return true; }
+
+  static bool supports(const IndexOperationType operation_type) {
+    switch (operation_type) {
+      case IndexOperationType::BulkLoad:
+        return false;
+      case IndexOperationType::BulkInsert:
+        return true;
+      case IndexOperationType::BulkErase:
+        return false;
+      case IndexOperationType::InsertEntry:
+        return true;
+      case IndexOperationType::EraseEntry:
+        return true;
+      case IndexOperationType::EqualityLookup:
+        return true;
+      case IndexOperationType::RangeLookup:
+        return true;
+    }
+  }
+
+  static bool supports_concurrent(const IndexOperationType operation_type) {
+    return operation_type == IndexOperationType::EqualityLookup || operation_type == IndexOperationType::RangeLookup;
+  }
+
+  static const std::string name() { return "SIMD Sorted Vector"; }
+
+  static IndexType type() { return IndexType::SimdSortedVector; }
+
+  void bulk_load(const Data<Key, Value>& data) { throw std::logic_error("Not supported."); }
+
+  void bulk_insert(const Data<Key, Value>& data) {
+    auto entries = std::vector<std::pair<Key, Value>>{};
+    entries.reserve(_keys.size() + data.entries().size());
+    for (size_t position = 0; position < _keys.size(); ++position) {
+      entries.emplace_back(_keys[position], _values[position]);
+    }
+    entries.insert(entries.end(), data.entries().cbegin(), data.entries().cend());
+    ParallelSort::sort(entries);
+
+    _keys.resize(entries.size());
+    _values.resize(entries.size());
+    ParallelSort::for_each_range(entries.size(), [&](const size_t begin, const size_t end) {
+      for (auto position = begin; position < end; ++position) {
+        _keys[position] = entries[position].first;
+        _values[position] = entries[position].second;
+      }
+    });
+  }
+
+  void bulk_erase(const Data<Key, Value>& data) { throw std::logic_error("Not supported."); }
+
+  void insert(const Key& key, const Value& value) {
+    const auto position = SimdSearch::upper_bound(_keys.data(), _keys.size(), key);
+    _keys.insert(_keys.begin() + position, key);
+    _values.insert(_values.begin() + position, value);
+  }
+
+  void erase(const Key& key, const Value& value) {
+    // reminder: we assume that the stored values are unique since they are tuple positions in a DBMS
+    for (auto position = SimdSearch::lower_bound(_keys.data(), _keys.size(), key);
+         position < _keys.size() && _keys[position] == key; ++position) {
+      if (_values[position] == value) {
+        _keys.erase(_keys.begin() + position);
+        _values.erase(_values.begin() + position);
+        return;
+      }
+    }
+  }
+
+  std::vector<Value> equality_lookup(const Key& key) const { return range_lookup(key, key); }
+
+  void equality_lookup(const Key& key, std::vector<Value>& result) const { range_lookup(key, key, result); }
+
+  std::vector<Value> range_lookup(const Key& lower_bound_key, const Key& upper_bound_key) const {
+    auto result = std::vector<Value>{};
+    range_lookup(lower_bound_key, upper_bound_key, result);
+    return result;
+  }
+
+  void range_lookup(const Key& lower_bound_key, const Key& upper_bound_key, std::vector<Value>& result) const {
+    const auto begin = SimdSearch::lower_bound(_keys.data(), _keys.size(), lower_bound_key);
+    const auto end = SimdSearch::upper_bound(_keys.data(), _keys.size(), upper_bound_key);
+    if (begin < end) {
+      result.insert(result.end(), _values.cbegin() + begin, _values.cbegin() + end);
+    }
+  }
+
+ protected:
+  std::vector<Key> _keys;
+  std::vector<Value> _values;
+};
+
+}  // namespace imib
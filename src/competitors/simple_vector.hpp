@@ -35,6 +35,10 @@ class SimpleVector {
     }
   }
 
+  static bool supports_concurrent(const IndexOperationType operation_type) {
+    return operation_type == IndexOperationType::EqualityLookup || operation_type == IndexOperationType::RangeLookup;
+  }
+
   static const std::string name() { return "Simple Vector"; }
 
   static IndexType type() { return IndexType::SimpleVector; }
@@ -42,7 +46,7 @@ class SimpleVector {
   void bulk_load(const Data<Key, Value>& data) { throw std::logic_error("Not supported."); }
 
   void bulk_insert(const Data<Key, Value>& data) {
-    _entries.insert(_entries.end(), data.entries.cbegin(), data.entries.cend());
+    _entries.insert(_entries.end(), data.entries().cbegin(), data.entries().cend());
   }
 
   void bulk_erase(const Data<Key, Value>& data) { throw std::logic_error("Not supported."); }
@@ -63,18 +67,26 @@ class SimpleVector {
 
   std::vector<Value> equality_lookup(const Key& key) const {
     auto result = std::vector<Value>{};
+    equality_lookup(key, result);
+    return result;
+  }
+
+  void equality_lookup(const Key& key, std::vector<Value>& result) const {
     for (auto iter = _entries.begin(); iter != _entries.end(); ++iter) {
       if (iter->first == key) {
         result.emplace_back(iter->second);
       }
     }
-    return result;
   }
 
   std::vector<Value> range_lookup(const Key& lower_bound_key, const Key& upper_bound_key) const {
     throw std::logic_error("Not supported.");
   }
 
+  void range_lookup(const Key& lower_bound_key, const Key& upper_bound_key, std::vector<Value>& result) const {
+    throw std::logic_error("Not supported.");
+  }
+
  protected:
   std::vector<std::pair<Key, Value>> _entries;
 };
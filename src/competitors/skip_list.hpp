@@ -49,13 +49,17 @@ class SkipList {
     }
   }
 
+  static bool supports_concurrent(const IndexOperationType operation_type) {
+    return operation_type == IndexOperationType::EqualityLookup || operation_type == IndexOperationType::RangeLookup;
+  }
+
   static const std::string name() { return "PG Skip List"; }
 
   static IndexType type() { return IndexType::SkipList; }
 
   void bulk_load(const Data<Key, Value>& data) { throw std::logic_error("Not supported."); }
 
-  void bulk_insert(const Data<Key, Value>& data) { _skip_list.insert(data.entries.cbegin(), data.entries.cend()); }
+  void bulk_insert(const Data<Key, Value>& data) { _skip_list.insert(data.entries().cbegin(), data.entries().cend()); }
 
   void bulk_erase(const Data<Key, Value>& data) { throw std::logic_error("Not supported."); }
 
@@ -78,11 +82,16 @@ class SkipList {
   }
 
   std::vector<Value> equality_lookup(const Key& key) const {
+    auto result = std::vector<Value>{};
+    equality_lookup(key, result);
+    return result;
+  }
+
+  void equality_lookup(const Key& key, std::vector<Value>& result) const {
     auto found = _skip_list.find({key, 0});
     if (found != _skip_list.cend()) {
-      return std::vector<Value>{(*found).second};
+      result.emplace_back((*found).second);
     }
-    return std::vector<Value>{};
     // multi skip list, non-unique values
     // const auto search_entry = SkipListEntry<Key, Value>(key);
     // const auto range = _skip_list.equal_range(search_entry);
@@ -96,15 +105,18 @@ class SkipList {
   }
 
   std::vector<Value> range_lookup(const Key& lower_bound_key, const Key& upper_bound_key) const {
+    auto result = std::vector<Value>{};
+    range_lookup(lower_bound_key, upper_bound_key, result);
+    return result;
+  }
+
+  void range_lookup(const Key& lower_bound_key, const Key& upper_bound_key, std::vector<Value>& result) const {
     auto lower_bound = _skip_list.lower_bound({lower_bound_key, 0});
     const auto upper_bound = _skip_list.upper_bound({upper_bound_key, 0});
 
-    auto result = std::vector<Value>{};
-    result.reserve(std::distance(lower_bound, upper_bound));
     for (; lower_bound != upper_bound; ++lower_bound) {
       result.emplace_back((*lower_bound).second);
     }
-    return result;
   }
 
  protected:
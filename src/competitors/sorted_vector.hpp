@@ -3,10 +3,14 @@
 #include <iostream>
 
 #include <algorithm>
+#include <cstddef>
+#include <span>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "types.hpp"
+#include "utils/parallel_sort.hpp"
 
 namespace imib {
 
@@ -22,7 +26,7 @@ class SortedVector {
       case IndexOperationType::BulkInsert:
         return true;
       case IndexOperationType::BulkErase:
-        return false;
+        return true;
       case IndexOperationType::InsertEntry:
         return true;
       case IndexOperationType::EraseEntry:
@@ -34,23 +38,58 @@ class SortedVector {
     }
   }
 
+  static bool supports_concurrent(const IndexOperationType operation_type) {
+    return operation_type == IndexOperationType::EqualityLookup || operation_type == IndexOperationType::RangeLookup;
+  }
+
   static const std::string name() { return "Sorted Vector"; }
 
   static IndexType type() { return IndexType::SortedVector; }
 
   void bulk_load(const Data<Key, Value>& data) { throw std::logic_error("Not supported."); }
 
+  // Only the inserted entries are sorted, then they are merged with the sorted stored entries, both with all cores.
   void bulk_insert(const Data<Key, Value>& data) {
-    _entries.insert(_entries.end(), data.entries.cbegin(), data.entries.cend());
-    std::sort(_entries.begin(), _entries.end());
+    auto inserted_entries = data.entries();
+    ParallelSort::sort(inserted_entries);
+    if (_entries.empty()) {
+      _entries = std::move(inserted_entries);
+      return;
+    }
+    const auto stored_count = _entries.size();
+    _entries.insert(_entries.end(), std::make_move_iterator(inserted_entries.begin()),
+                    std::make_move_iterator(inserted_entries.end()));
+    ParallelSort::merge(_entries, stored_count);
   }
 
-  void bulk_erase(const Data<Key, Value>& data) { throw std::logic_error("Not supported."); }
+  // The entries to erase are sorted, then the remaining entries are moved to the front in one merge-like pass. Thus, a
+  // bulk erase shifts each entry at most once instead of once per erased entry before it.
+  void bulk_erase(const Data<Key, Value>& data) {
+    auto erased_entries = data.entries();
+    std::sort(erased_entries.begin(), erased_entries.end());
+
+    auto erased_iter = erased_entries.cbegin();
+    auto remaining_end = _entries.begin();
+    for (auto iter = _entries.begin(); iter != _entries.end(); ++iter) {
+      while (erased_iter != erased_entries.cend() && *erased_iter < *iter) {
+        ++erased_iter;
+      }
+      if (erased_iter != erased_entries.cend() && *erased_iter == *iter) {
+        // each erased entry removes one stored entry, also if the entry is stored multiple times
+        ++erased_iter;
+      } else {
+        *remaining_end = std::move(*iter);
+        ++remaining_end;
+      }
+    }
+    _entries.erase(remaining_end, _entries.end());
+  }
 
   // https://stackoverflow.com/questions/15048466/inserting-element-to-a-sorted-vector-and-keeping-elements-sorted/15048651
   void insert(const Key& key, const Value& value) {
-    const auto compare = [](const auto search_key, const auto entry) { return search_key < entry.first; };
-    _entries.insert(std::upper_bound(_entries.begin(), _entries.end(), key, compare), {key, value});
+    // the entries are ordered by key and value, as after a bulk insert, thus, erase can search for the entry
+    const auto entry = std::pair<Key, Value>{key, value};
+    _entries.insert(std::upper_bound(_entries.begin(), _entries.end(), entry), entry);
   }
 
   void erase(const Key& key, const Value& value) {
@@ -64,7 +103,15 @@ class SortedVector {
 
   std::vector<Value> equality_lookup(const Key& key) const { return range_lookup(key, key); }
 
+  void equality_lookup(const Key& key, std::vector<Value>& result) const { range_lookup(key, key, result); }
+
   std::vector<Value> range_lookup(const Key& lower_bound_key, const Key& upper_bound_key) const {
+    auto result = std::vector<Value>{};
+    range_lookup(lower_bound_key, upper_bound_key, result);
+    return result;
+  }
+
+  void range_lookup(const Key& lower_bound_key, const Key& upper_bound_key, std::vector<Value>& result) const {
     using TypedEntry = std::pair<Key, Value>;
     const auto compare_lower_bound = [](const TypedEntry entry, const Key& search_key) {
       return entry.first < search_key;
@@ -76,15 +123,46 @@ class SortedVector {
     auto lower_bound = std::lower_bound(_entries.begin(), _entries.end(), lower_bound_key, compare_lower_bound);
     const auto upper_bound = std::upper_bound(_entries.begin(), _entries.end(), upper_bound_key, compare_upper_bound);
 
-    auto result = std::vector<Value>{};
-    result.reserve(std::distance(lower_bound, upper_bound));
     for (; lower_bound != upper_bound; ++lower_bound) {
       result.emplace_back(lower_bound->second);
     }
-    return result;
+  }
+
+  // Appends the values of all keys in the order of the keys. The keys are searched in groups of BATCH_GROUP_SIZE keys
+  // whose binary searches are interleaved: each step advances all searches of the group and prefetches the entries of
+  // their next step. Thus, the cache misses of the searches overlap instead of each search waiting for its own misses.
+  void equality_lookup_batch(const std::span<const Key> keys, std::vector<Value>& result) const {
+    if (_entries.empty()) {
+      return;
+    }
+    const auto* entries = _entries.data();
+    size_t positions[BATCH_GROUP_SIZE];
+    for (size_t group_begin = 0; group_begin < keys.size(); group_begin += BATCH_GROUP_SIZE) {
+      const auto group = keys.subspan(group_begin, std::min(BATCH_GROUP_SIZE, keys.size() - group_begin));
+      std::fill(positions, positions + group.size(), size_t{0});
+      // branch-free lower bound searches, all searches of the group take the same number of steps
+      for (auto size = _entries.size(); size > 1;) {
+        const auto half = size / 2;
+        size -= half;
+        for (size_t index = 0; index < group.size(); ++index) {
+          positions[index] = entries[positions[index] + half].first < group[index] ? positions[index] + half
+                                                                                    : positions[index];
+          __builtin_prefetch(entries + positions[index] + size / 2);
+        }
+      }
+      for (size_t index = 0; index < group.size(); ++index) {
+        for (auto position = positions[index] + (entries[positions[index]].first < group[index] ? 1 : 0);
+             position < _entries.size() && entries[position].first == group[index]; ++position) {
+          result.emplace_back(entries[position].second);
+        }
+      }
+    }
   }
 
  protected:
+  // the number of interleaved searches of equality_lookup_batch
+  static constexpr size_t BATCH_GROUP_SIZE = 16;
+
   std::vector<std::pair<Key, Value>> _entries;
 };
 
@@ -1,9 +1,14 @@
 #pragma once
 
+#include <algorithm>
+#include <cstddef>
+#include <span>
 #include <string>
 #include <unordered_map>
 #include <vector>
 
+#include "utils/hash_map_shrinking.hpp"
+
 // supports non-unique keys
 
 namespace imib {
@@ -20,7 +25,7 @@ class UnorderedMap {
       case IndexOperationType::BulkInsert:
         return true;
       case IndexOperationType::BulkErase:
-        return false;
+        return true;
       case IndexOperationType::InsertEntry:
         return true;
       case IndexOperationType::EraseEntry:
@@ -32,15 +37,35 @@ class UnorderedMap {
     }
   }
 
+  static bool supports_concurrent(const IndexOperationType operation_type) {
+    return operation_type == IndexOperationType::EqualityLookup || operation_type == IndexOperationType::RangeLookup;
+  }
+
   static const std::string name() { return "STD Hash Map"; }
 
   static IndexType type() { return IndexType::UnorderedMap; }
 
   void bulk_load(const Data<Key, Value>& data) { throw std::logic_error("Not supported."); }
 
-  void bulk_insert(const Data<Key, Value>& data) { _map.insert(data.entries.cbegin(), data.entries.cend()); }
-
-  void bulk_erase(const Data<Key, Value>& data) { throw std::logic_error("Not supported."); }
+  void bulk_insert(const Data<Key, Value>& data) { _map.insert(data.entries().cbegin(), data.entries().cend()); }
+
+  // prefetches the buckets of a group of keys before it erases them, then shrinks the table, see HashMapShrinking
+  void bulk_erase(const Data<Key, Value>& data) {
+    const auto& entries = data.entries();
+    for (size_t group_begin = 0; group_begin < entries.size(); group_begin += BATCH_GROUP_SIZE) {
+      const auto group_end = std::min(group_begin + BATCH_GROUP_SIZE, entries.size());
+      for (auto index = group_begin; index < group_end; ++index) {
+        const auto bucket = _map.bucket(entries[index].first);
+        if (_map.cbegin(bucket) != _map.cend(bucket)) {
+          __builtin_prefetch(&*_map.cbegin(bucket));
+        }
+      }
+      for (auto index = group_begin; index < group_end; ++index) {
+        _map.erase(entries[index].first);
+      }
+    }
+    HashMapShrinking::shrink_after_bulk_erase(_map);
+  }
 
   void insert(const Key& key, const Value& value) { _map.insert({key, value}); }
 
@@ -58,11 +83,16 @@ class UnorderedMap {
   }
 
   std::vector<Value> equality_lookup(const Key& key) const {
+    auto result = std::vector<Value>{};
+    equality_lookup(key, result);
+    return result;
+  }
+
+  void equality_lookup(const Key& key, std::vector<Value>& result) const {
     const auto found = _map.find(key);
     if (found != _map.cend()) {
-      return std::vector<Value>{found->second};
+      result.emplace_back(found->second);
     }
-    return std::vector<Value>{};
     // unorderex multimap
     // const auto range = _map.equal_range(key);
     // auto result = std::vector<Value>{};
@@ -74,11 +104,46 @@ class UnorderedMap {
     // return result;
   }
 
+  // Appends the values of all keys in the order of the keys, like a hash join probes its hash table. The keys of a
+  // group of BATCH_GROUP_SIZE keys are hashed first, then the bucket of each key is loaded and its first node
+  // prefetched, and only then the buckets are searched. Thus, the cache misses of the buckets and the nodes of the
+  // group overlap.
+  void equality_lookup_batch(const std::span<const Key> keys, std::vector<Value>& result) const {
+    size_t buckets[BATCH_GROUP_SIZE];
+    for (size_t group_begin = 0; group_begin < keys.size(); group_begin += BATCH_GROUP_SIZE) {
+      const auto group = keys.subspan(group_begin, std::min(BATCH_GROUP_SIZE, keys.size() - group_begin));
+      for (size_t index = 0; index < group.size(); ++index) {
+        buckets[index] = _map.bucket(group[index]);
+      }
+      for (size_t index = 0; index < group.size(); ++index) {
+        const auto node = _map.cbegin(buckets[index]);
+        if (node != _map.cend(buckets[index])) {
+          __builtin_prefetch(&*node);
+        }
+      }
+      for (size_t index = 0; index < group.size(); ++index) {
+        for (auto node = _map.cbegin(buckets[index]); node != _map.cend(buckets[index]); ++node) {
+          if (node->first == group[index]) {
+            result.emplace_back(node->second);
+            break;
+          }
+        }
+      }
+    }
+  }
+
   std::vector<Value> range_lookup(const Key& lower_bound_key, const Key& upper_bound_key) const {
     throw std::logic_error("Not supported.");
   }
 
+  void range_lookup(const Key& lower_bound_key, const Key& upper_bound_key, std::vector<Value>& result) const {
+    throw std::logic_error("Not supported.");
+  }
+
  protected:
+  // the number of interleaved lookups of equality_lookup_batch and erases of bulk_erase
+  static constexpr size_t BATCH_GROUP_SIZE = 16;
+
   std::unordered_map<Key, Value> _map;
 };
 
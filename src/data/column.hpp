@@ -18,7 +18,7 @@ class Column {
   // - 1 since the TID starts at 1.
   static AttributeValue& value_at(const size_t tid) { return (*values)[tid - 1]; }
 
-  static void fill(const std::vector<std::pair<AttributeValue, TID>> entries) {
+  static void fill(const std::vector<std::pair<AttributeValue, TID>>& entries) {
     // find the maximum tid of the entries
     size_t max_tid = 0;
     for (const auto& entry : entries) {
@@ -1,12 +1,17 @@
 #pragma once
 
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
 #include <vector>
 
-#include "entry_generator.hpp"
 #include "key_generator.hpp"
 #include "lookup_generator.hpp"
+#include "mapped_binary_file.hpp"
+#include "mapped_string_file.hpp"
 #include "random_key_generator.hpp"
-#include "tid_generator.hpp"
 #include "types.hpp"
 
 namespace imib {
@@ -15,15 +20,27 @@ class DataGenerator {
  public:
   DataGenerator() = delete;
 
+  // The key file is mapped instead of read into a buffer. The data keeps the mapping alive and materializes its
+  // representations from the mapped keys on demand, thus, the keys are only copied for the representations in use.
+  // String keys (std::string_view) are read from a string file (see MappedStringFile) and point into its mapping.
   template <typename Key, typename Value>
-  static Data<Key, Value> generate(const std::string& file_path) {
-    const auto keys = KeyGenerator::generate<Key>(file_path);
-    const auto values = TIDGenerator::generate<Key, Value>(keys);
-    const auto entries = EntryGenerator::generate<Key, Value>(keys);
-    // BBTree required float keys (const std::vector<std::vector<float>>) for the bulk load operation
-    const auto float_keys = KeyGenerator::generate_float<Key>(keys);
-    const auto data = Data(std::move(keys), std::move(values), std::move(entries), std::move(float_keys));
-    return data;
+  static Data<Key, Value> generate(const std::string& file_path, const MappingOptions options = {}) {
+    const auto file = std::make_shared<const MappedKeyFile<Key>>(file_path, options);
+    return Data<Key, Value>(file->values(), file);
+  }
+
+  // Generates unique keys from the distribution, or keys with duplicates if its distinct count is set. The data keeps
+  // the generated keys alive. String keys point into one arena (see RandomKeyGenerator::generate_strings).
+  template <typename Key, typename Value>
+  static Data<Key, Value> generate(const KeyDistribution& distribution) {
+    if constexpr (std::is_same_v<Key, std::string_view>) {
+      const auto arena = RandomKeyGenerator::generate_strings(distribution, distribution.distinct_count == 0);
+      return Data<Key, Value>(arena->values(), arena);
+    } else {
+      const auto keys = std::make_shared<const std::vector<Key>>(
+          RandomKeyGenerator::generate<Key>(distribution, distribution.distinct_count == 0));
+      return Data<Key, Value>(std::span<const Key>{*keys}, keys);
+    }
   }
 };
 
@@ -1,26 +1,19 @@
 #pragma once
 
-#include <fstream>
-#include <ios>
+#include <string>
+#include <vector>
+
+#include "mapped_binary_file.hpp"
 
 namespace imib {
 
+// The binary files store the value count as uint64_t followed by the values. Use the MappedBinaryFile to read the
+// values without copying them. Strings are stored with their lengths, see MappedStringFile.
 template <typename T>
 static std::vector<T> load_binary_data(const std::string& filename) {
-  std::vector<T> values;
-  std::ifstream input_file(filename, std::ios::binary);
-  if (!input_file.is_open()) {
-    throw std::logic_error("Opening " + filename + " failed.");
-  }
-  // read the value count which is stored as first value
-  uint64_t value_count;
-  input_file.read(reinterpret_cast<char*>(&value_count), sizeof(uint64_t));
-  values.resize(value_count);
-  // read the values
-  input_file.read(reinterpret_cast<char*>(values.data()), value_count * sizeof(T));
-  input_file.close();
-
-  return values;
+  const auto file = MappedBinaryFile<T>{filename};
+  const auto values = file.values();
+  return std::vector<T>(values.begin(), values.end());
 }
 
 }  // namespace imib
@@ -1,9 +1,19 @@
 #pragma once
 
 #include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
 #include <vector>
 
-#include "load_binary_data.hpp"
+#include "mapped_binary_file.hpp"
+#include "rank_generator.hpp"
 #include "types.hpp"
 
 namespace imib {
@@ -12,22 +22,37 @@ class LookupGenerator {
  public:
   LookupGenerator() = delete;
 
+  // String lookups point into their file, thus, map string lookup files with MappedStringFile and pass their keys.
   template <typename Key>
   static std::vector<EqualityLookup<Key>> generate_equality_lookups(const std::string& filename) {
-    auto keys = load_binary_data<Key>(filename);
+    static_assert(!std::is_same_v<Key, std::string_view>, "The lookups would point into the unmapped file.");
+    const auto file = MappedBinaryFile<Key>{filename};
+    return generate_equality_lookups<Key>(file.values());
+  }
+
+  template <typename Key>
+  static std::vector<RangeLookup<Key>> generate_range_lookups(const std::string& filename) {
+    static_assert(!std::is_same_v<Key, std::string_view>, "The lookups would point into the unmapped file.");
+    const auto file = MappedBinaryFile<Key>{filename};
+    return generate_range_lookups<Key>(file.values());
+  }
+
+  // the keys of a lookup file
+  template <typename Key>
+  static std::vector<EqualityLookup<Key>> generate_equality_lookups(const std::span<const Key> keys) {
     auto lookups = std::vector<EqualityLookup<Key>>{};
     lookups.reserve(keys.size());
-    for (auto& key : keys) {
+    for (const auto& key : keys) {
       lookups.emplace_back(key);
     }
     return lookups;
   }
 
+  // the keys of a lookup file, every two consecutive keys form a range
   template <typename Key>
-  static std::vector<RangeLookup<Key>> generate_range_lookups(const std::string& filename) {
+  static std::vector<RangeLookup<Key>> generate_range_lookups(const std::span<const Key> keys) {
     // every two consecutive values form a pair of values that defines a range.
     // the smaller value is the lower bound value, the larger one the upper bound value.
-    auto keys = load_binary_data<Key>(filename);
     if (keys.size() % 2 > 0) {
       throw std::logic_error(
           "Cannot build ranges: an even number of values is required. Two consecutive values form a value pair, i.e., "
@@ -42,6 +67,67 @@ class LookupGenerator {
     }
     return lookups;
   }
+
+  // Draws distribution.count lookup keys from the keys of the data, which are ranked in their order. The ranks of the
+  // Zipfian and Hotspot distributions are assigned to random keys, thus, the hot keys are spread over the key range,
+  // like the scrambled Zipfian distribution of YCSB. The Latest distribution prefers the last keys, i.e., the most
+  // recently inserted ones, and the Normal distribution the keys in the middle of the data.
+  template <typename Key>
+  static std::vector<EqualityLookup<Key>> generate_equality_lookups(const std::vector<Key>& keys,
+                                                                    const KeyDistribution& distribution) {
+    if (keys.empty()) {
+      throw std::logic_error("Cannot generate lookups without keys.");
+    }
+    auto random_engine = std::mt19937_64{distribution.seed};
+    const auto positions = _rank_positions(distribution, keys.size(), random_engine);
+    const auto rank_generator = RankGenerator{distribution, keys.size()};
+    auto lookups = std::vector<EqualityLookup<Key>>{};
+    lookups.reserve(distribution.count);
+    for (size_t lookup = 0; lookup < distribution.count; ++lookup) {
+      lookups.emplace_back(keys[positions[rank_generator(random_engine)]]);
+    }
+    return lookups;
+  }
+
+  // Draws distribution.count range lookups that each span range_size consecutive distinct keys (fewer at the end of
+  // the key range). The lower bound keys are drawn like the keys of the equality lookups, but ranked in ascending
+  // order, i.e., the Latest distribution prefers the largest keys.
+  template <typename Key>
+  static std::vector<RangeLookup<Key>> generate_range_lookups(const std::vector<Key>& keys,
+                                                              const KeyDistribution& distribution,
+                                                              const size_t range_size) {
+    if (keys.empty() || range_size == 0) {
+      throw std::logic_error("Cannot generate range lookups without keys or with empty ranges.");
+    }
+    auto sorted_keys = keys;
+    std::sort(sorted_keys.begin(), sorted_keys.end());
+    sorted_keys.erase(std::unique(sorted_keys.begin(), sorted_keys.end()), sorted_keys.end());
+
+    auto random_engine = std::mt19937_64{distribution.seed};
+    const auto positions = _rank_positions(distribution, sorted_keys.size(), random_engine);
+    const auto rank_generator = RankGenerator{distribution, sorted_keys.size()};
+    auto lookups = std::vector<RangeLookup<Key>>{};
+    lookups.reserve(distribution.count);
+    for (size_t lookup = 0; lookup < distribution.count; ++lookup) {
+      const auto lower_bound_position = positions[rank_generator(random_engine)];
+      const auto upper_bound_position = std::min(lower_bound_position + range_size - 1, sorted_keys.size() - 1);
+      lookups.emplace_back(sorted_keys[lower_bound_position], sorted_keys[upper_bound_position]);
+    }
+    return lookups;
+  }
+
+ protected:
+  // returns the position of the key for each rank
+  template <typename RandomEngine>
+  static std::vector<size_t> _rank_positions(const KeyDistribution& distribution, const size_t key_count,
+                                             RandomEngine& random_engine) {
+    auto positions = std::vector<size_t>(key_count);
+    std::iota(positions.begin(), positions.end(), size_t{0});
+    if (distribution.type == DistributionType::Zipfian || distribution.type == DistributionType::Hotspot) {
+      std::shuffle(positions.begin(), positions.end(), random_engine);
+    }
+    return positions;
+  }
 };
 
 }  // namespace imib
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <stdexcept>
+#include <string>
+
+namespace imib {
+
+struct MappingOptions {
+  // prefault the page tables of the whole file with MAP_POPULATE, i.e., read the file while mapping it
+  bool populate = false;
+  // advise the kernel to back the mapping with transparent huge pages. Whether file-backed huge pages are used depends
+  // on the kernel and the file system.
+  bool huge_pages = false;
+};
+
+// Maps a file read-only into memory and exposes its bytes without copying them. The bytes are valid as long as the
+// MappedFile exists.
+class MappedFile final {
+ public:
+  explicit MappedFile(const std::string& filename, const MappingOptions options = {}) {
+    const auto file_descriptor = open(filename.c_str(), O_RDONLY);
+    if (file_descriptor == -1) {
+      throw std::logic_error("Opening " + filename + " failed.");
+    }
+    struct stat file_status {};
+    if (fstat(file_descriptor, &file_status) == -1) {
+      close(file_descriptor);
+      throw std::logic_error("Reading the size of " + filename + " failed.");
+    }
+    _mapping_size = static_cast<size_t>(file_status.st_size);
+    if (_mapping_size < sizeof(uint64_t)) {
+      close(file_descriptor);
+      throw std::logic_error(filename + " does not contain a value count.");
+    }
+
+    const auto flags = MAP_PRIVATE | (options.populate ? MAP_POPULATE : 0);
+    _mapping = mmap(nullptr, _mapping_size, PROT_READ, flags, file_descriptor, 0);
+    // the mapping keeps a reference to the file
+    close(file_descriptor);
+    if (_mapping == MAP_FAILED) {
+      throw std::logic_error("Mapping " + filename + " failed.");
+    }
+    if (options.huge_pages) {
+      // only a hint, the mapping works without huge pages
+      madvise(_mapping, _mapping_size, MADV_HUGEPAGE);
+    }
+  }
+
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+
+  ~MappedFile() { munmap(_mapping, _mapping_size); }
+
+  // the mapping is page-aligned, thus, the values that follow the value count are aligned
+  std::span<const std::byte> bytes() const { return {static_cast<const std::byte*>(_mapping), _mapping_size}; }
+
+  // returns the value count at the beginning of the file
+  uint64_t value_count() const {
+    uint64_t value_count;
+    std::memcpy(&value_count, _mapping, sizeof(uint64_t));
+    return value_count;
+  }
+
+ private:
+  void* _mapping;
+  size_t _mapping_size;
+};
+
+// Maps a binary data file (the value count as uint64_t followed by the values, see load_binary_data) read-only into
+// memory and exposes its values as a span without copying them. The values are valid as long as the
+// MappedBinaryFile exists.
+template <typename T>
+class MappedBinaryFile final {
+ public:
+  explicit MappedBinaryFile(const std::string& filename, const MappingOptions options = {})
+      : _file(filename, options) {
+    const auto bytes = _file.bytes();
+    const auto value_count = _file.value_count();
+    if (value_count > (bytes.size() - sizeof(uint64_t)) / sizeof(T)) {
+      throw std::logic_error(filename + " contains fewer values than its value count.");
+    }
+    const auto* values = static_cast<const T*>(static_cast<const void*>(bytes.data() + sizeof(uint64_t)));
+    _values = std::span<const T>{values, value_count};
+  }
+
+  std::span<const T> values() const { return _values; }
+
+ private:
+  const MappedFile _file;
+  std::span<const T> _values;
+};
+
+}  // namespace imib
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include "mapped_binary_file.hpp"
+
+namespace imib {
+
+// Maps a binary string file read-only into memory and exposes its strings as views into the mapping, i.e., the
+// strings are neither copied nor allocated one by one. The file stores the string count as uint64_t followed by the
+// strings, each as its length (uint32_t) followed by its characters without a terminating 0. The views are valid as
+// long as the MappedStringFile exists.
+class MappedStringFile final {
+ public:
+  explicit MappedStringFile(const std::string& filename, const MappingOptions options = {})
+      : _file(filename, options) {
+    const auto bytes = _file.bytes();
+    const auto string_count = _file.value_count();
+    // each string occupies at least its length
+    if (string_count > (bytes.size() - sizeof(uint64_t)) / sizeof(uint32_t)) {
+      throw std::logic_error(filename + " contains fewer strings than its string count.");
+    }
+    _views.reserve(string_count);
+    auto offset = sizeof(uint64_t);
+    for (uint64_t string = 0; string < string_count; ++string) {
+      uint32_t length;
+      if (bytes.size() - offset < sizeof(uint32_t)) {
+        throw std::logic_error(filename + " contains fewer strings than its string count.");
+      }
+      std::memcpy(&length, bytes.data() + offset, sizeof(uint32_t));
+      offset += sizeof(uint32_t);
+      if (bytes.size() - offset < length) {
+        throw std::logic_error(filename + " contains a string that exceeds the file.");
+      }
+      _views.emplace_back(reinterpret_cast<const char*>(bytes.data() + offset), length);
+      offset += length;
+    }
+  }
+
+  std::span<const std::string_view> values() const { return _views; }
+
+ private:
+  const MappedFile _file;
+  std::vector<std::string_view> _views;
+};
+
+// the file of the keys of the given type, string keys are stored in string files and the other keys in binary files
+template <typename Key>
+using MappedKeyFile =
+    std::conditional_t<std::is_same_v<Key, std::string_view>, MappedStringFile, MappedBinaryFile<Key>>;
+
+}  // namespace imib
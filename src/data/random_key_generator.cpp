@@ -1,103 +1,135 @@
 #include "random_key_generator.hpp"
 
 #include <algorithm>
-#include <functional>
+#include <charconv>
 #include <limits>
 #include <random>
+#include <sstream>
 #include <stdexcept>
+#include <string_view>
 #include <unordered_set>
 #include <vector>
 
+#include "rank_generator.hpp"
+
 namespace imib {
 
 template <typename Key>
-std::vector<Key> RandomKeyGenerator::generate(const DistributionType distribution_type, const uint64_t entry_count,
-                                              const bool unique_keys_required) {
-  // setup value generation function and data name
-  std::function<Key()> generate_value = nullptr;
-  std::string data_name{};
-
-  std::random_device random_device;
-  std::mt19937 random_engine(random_device());
-
-  switch (distribution_type) {
-    case DistributionType::Normal:
-      throw std::logic_error("Passed data generation strategy is not supported.");
-    case DistributionType::Uniform:
-      static_assert(std::is_same_v<Key, int32_t> || std::is_same_v<Key, int64_t>,
-                    "Only int32_t or int64_t keys are supported.");
-      std::uniform_int_distribution<Key> uniform_int_distribution(1, 50);
-      generate_value = [&]() { return uniform_int_distribution(random_engine); };
-      data_name = "Uniform";
-      break;
+std::vector<Key> RandomKeyGenerator::generate(const KeyDistribution& distribution, const bool unique_keys_required) {
+  static_assert(std::is_integral_v<Key>, "Only integer keys are supported.");
+  const auto max_key = static_cast<uint64_t>(std::numeric_limits<Key>::max());
+  const auto key_count = distribution.distinct_count > 0 ? std::min(distribution.distinct_count, max_key) : max_key;
+  if (unique_keys_required && distribution.count > key_count) {
+    throw std::logic_error("The key distribution contains fewer distinct keys than unique keys are required.");
   }
+  const auto rank_generator = RankGenerator{distribution, key_count};
+  auto random_engine = std::mt19937_64{distribution.seed};
+  const auto generate_value = [&]() { return static_cast<Key>(rank_generator(random_engine) + 1); };
 
   // generate keys
-  std::vector<Key> keys(entry_count);
+  std::vector<Key> keys;
+  keys.reserve(distribution.count);
 
   if (unique_keys_required) {
-    // generate unique keys
+    // generate unique keys, which keep the order in which they were drawn first
     std::unordered_set<Key> unique_keys{};
-    unique_keys.reserve(entry_count);
-
-    while (unique_keys.size() < entry_count) {
-      unique_keys.insert(generate_value());
-    }
+    unique_keys.reserve(distribution.count);
 
-    auto iter = unique_keys.begin();
-    auto position = 0u;
-    while (iter != unique_keys.end()) {
-      keys[position] = std::move(unique_keys.extract(iter++).value());
-      ++position;
+    while (keys.size() < distribution.count) {
+      const auto value = generate_value();
+      if (unique_keys.insert(value).second) {
+        keys.push_back(value);
+      }
     }
   } else {
     // generate keys that can contain duplicates
-    for (uint64_t position = 0; position < entry_count; ++position) {
-      auto value = generate_value();
-      keys[position] = value;
+    for (uint64_t position = 0; position < distribution.count; ++position) {
+      keys.push_back(generate_value());
     }
   }
 
   return keys;
-  // TODO(Marcel) create a better technique for generating the lookup lists
-  // generate equality lookups
-  // std::vector<Key> equality_lookups{};
-  // equality_lookups.reserve(_equality_lookup_count);
-
-  // std::sample(keys.begin(), keys.end(), std::back_inserter(equality_lookups), _equality_lookup_count,
-  //             std::mt19937{std::random_device{}()});
-
-  // // generate range lookups
-  // std::vector<Key> flattened_range_lookups{};
-  // flattened_range_lookups.reserve(2 * _range_lookup_count);
-
-  // std::sample(keys.begin(), keys.end(), std::back_inserter(flattened_range_lookups), 2 * _range_lookup_count,
-  //             std::mt19937{std::random_device{}()});
-
-  // std::vector<std::pair<Key, Key>> range_lookups{};
-  // range_lookups.reserve(_range_lookup_count);
-
-  // for (auto index = 0u; index < flattened_range_lookups.size(); ++index) {
-  //   if (index % 2 == 0) {
-  //     continue;
-  //   }
-  //   // for each odd index
-  //   const auto& first = flattened_range_lookups[index - 1];
-  //   const auto& second = flattened_range_lookups[index];
-  //   range_lookups.emplace_back(std::min(first, second), std::max(first, second));
-  // }
-
-  // auto data = std::make_shared<Data<Key, Value>>(data_name, std::move(entries), unique_keys_required,
-  // equality_lookups, range_lookups);
-  // return data;
 }
 
-template std::vector<int32_t> RandomKeyGenerator::generate<int32_t>(const DistributionType distribution_type,
-                                                                    const uint64_t entry_count,
+std::shared_ptr<const StringArena> RandomKeyGenerator::generate_strings(const KeyDistribution& distribution,
+                                                                       const bool unique_keys_required) {
+  static constexpr auto PREFIX = std::string_view{"user"};
+  const auto keys = generate<uint64_t>(distribution, unique_keys_required);
+  auto bytes = std::vector<char>{};
+  auto lengths = std::vector<size_t>{};
+  lengths.reserve(keys.size());
+  // the prefix and the at most 20 digits of a 64-bit key
+  char key_string[PREFIX.size() + 20];
+  std::copy(PREFIX.cbegin(), PREFIX.cend(), key_string);
+  for (const auto key : keys) {
+    const auto end = std::to_chars(key_string + PREFIX.size(), key_string + sizeof(key_string), key).ptr;
+    bytes.insert(bytes.end(), key_string, end);
+    lengths.push_back(static_cast<size_t>(end - key_string));
+  }
+  return std::make_shared<const StringArena>(std::move(bytes), lengths);
+}
+
+std::string RandomKeyGenerator::distribution_name(const DistributionType distribution_type) {
+  switch (distribution_type) {
+    case DistributionType::Normal:
+      return "normal";
+    case DistributionType::Uniform:
+      return "uniform";
+    case DistributionType::Zipfian:
+      return "zipfian";
+    case DistributionType::Hotspot:
+      return "hotspot";
+    case DistributionType::Latest:
+      return "latest";
+  }
+  return "";
+}
+
+DistributionType RandomKeyGenerator::distribution_type(const std::string& distribution_name) {
+  for (const auto type : {DistributionType::Normal, DistributionType::Uniform, DistributionType::Zipfian,
+                          DistributionType::Hotspot, DistributionType::Latest}) {
+    if (RandomKeyGenerator::distribution_name(type) == distribution_name) {
+      return type;
+    }
+  }
+  throw std::logic_error("Unknown key distribution '" + distribution_name + "'.");
+}
+
+std::string RandomKeyGenerator::describe(const KeyDistribution& distribution) {
+  auto description = std::ostringstream{};
+  description << distribution_name(distribution.type) << "(count=" << distribution.count;
+  switch (distribution.type) {
+    case DistributionType::Normal:
+      description << ", standard_deviation=" << distribution.standard_deviation;
+      break;
+    case DistributionType::Uniform:
+      break;
+    case DistributionType::Zipfian:
+    case DistributionType::Latest:
+      description << ", skew=" << distribution.skew;
+      break;
+    case DistributionType::Hotspot:
+      description << ", hot_probability=" << distribution.hot_probability
+                  << ", hot_fraction=" << distribution.hot_fraction;
+      break;
+  }
+  if (distribution.distinct_count > 0) {
+    description << ", distinct_count=" << distribution.distinct_count;
+  }
+  description << ", seed=" << distribution.seed << ")";
+  return description.str();
+}
+
+template std::vector<int32_t> RandomKeyGenerator::generate<int32_t>(const KeyDistribution& distribution,
                                                                     const bool unique_keys_required);
 
-template std::vector<int64_t> RandomKeyGenerator::generate<int64_t>(const DistributionType distribution_type,
-                                                                    const uint64_t entry_count,
+template std::vector<int64_t> RandomKeyGenerator::generate<int64_t>(const KeyDistribution& distribution,
                                                                     const bool unique_keys_required);
 
+template std::vector<uint32_t> RandomKeyGenerator::generate<uint32_t>(const KeyDistribution& distribution,
+                                                                      const bool unique_keys_required);
+
+template std::vector<uint64_t> RandomKeyGenerator::generate<uint64_t>(const KeyDistribution& distribution,
+                                                                      const bool unique_keys_required);
+
 }  // namespace imib
@@ -4,22 +4,38 @@
 #include <functional>
 #include <memory>
 #include <random>
+#include <string>
 #include <vector>
 
+#include "string_arena.hpp"
 #include "types.hpp"
 
 namespace imib {
 
 // c++ std lib distributions: https://en.cppreference.com/w/cpp/numeric/random
 
-enum class DistributionType { Normal, Uniform };
-
 class RandomKeyGenerator {
  public:
   RandomKeyGenerator() = delete;
+
+  // Generates distribution.count keys of the domain [1, max. Key value] in the order they are drawn. The first rank
+  // of the distribution (see RankGenerator) is the key 1. If unique keys are required, duplicates are drawn again.
   template <typename Key>
-  static std::vector<Key> generate(const DistributionType distribution_type, const uint64_t entry_count,
-                                   const bool unique_keys_required);
+  static std::vector<Key> generate(const KeyDistribution& distribution, const bool unique_keys_required);
+
+  // Generates distribution.count string keys like the keys of YCSB, i.e., "user" followed by the decimal digits of a
+  // 64-bit key drawn by generate, thus, the keys differ in length and share a prefix. The keys are stored in one arena.
+  static std::shared_ptr<const StringArena> generate_strings(const KeyDistribution& distribution,
+                                                             const bool unique_keys_required);
+
+  // returns the name of the distribution as used in the benchmark plan and the result file
+  static std::string distribution_name(const DistributionType distribution_type);
+
+  // throws if the name is not the name of a distribution
+  static DistributionType distribution_type(const std::string& distribution_name);
+
+  // returns the distribution with its parameters and seed, e.g., to name generated data in the result file
+  static std::string describe(const KeyDistribution& distribution);
 };
 
 }  // namespace imib
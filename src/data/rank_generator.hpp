@@ -0,0 +1,116 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <random>
+
+#include "types.hpp"
+
+namespace imib {
+
+// Draws ranks in [0, rank_count) from a key distribution. Rank 0 is the most frequent rank of the Zipfian distribution
+// and rank_count - 1 the most frequent one of the Latest distribution, i.e., the latest ranks are the most popular.
+// The hot set of the Hotspot distribution are the first ranks, and the Normal distribution is centered in the middle
+// of the ranks. The generators decide how the ranks are mapped to keys.
+// The Zipf distribution is sampled by rejection-inversion (Hörmann and Derflinger, "Rejection-inversion to generate
+// variates from monotone discrete distributions", 1996), which needs constant time and memory independent of the
+// number of ranks, thus, it can also be used for the whole domain of 64-bit keys.
+class RankGenerator final {
+ public:
+  RankGenerator(const KeyDistribution& distribution, const uint64_t rank_count)
+      : _distribution(distribution), _rank_count(rank_count) {
+    if (_distribution.type == DistributionType::Zipfian || _distribution.type == DistributionType::Latest) {
+      const auto exponent = _distribution.skew;
+      _h_integral_x1 = _h_integral(1.5, exponent) - 1.0;
+      _h_integral_n = _h_integral(static_cast<double>(_rank_count) + 0.5, exponent);
+      _s = 2.0 - _h_integral_inverse(_h_integral(2.5, exponent) - _h(2.0, exponent), exponent);
+    }
+  }
+
+  template <typename RandomEngine>
+  uint64_t operator()(RandomEngine& random_engine) const {
+    const auto last_rank = _rank_count - 1;
+    switch (_distribution.type) {
+      case DistributionType::Uniform:
+        return std::uniform_int_distribution<uint64_t>{0, last_rank}(random_engine);
+      case DistributionType::Zipfian:
+        return _zipf(random_engine) - 1;
+      case DistributionType::Latest:
+        return _rank_count - _zipf(random_engine);
+      case DistributionType::Hotspot: {
+        // at least one hot and, if possible, one cold rank
+        const auto hot_count = std::clamp(
+            static_cast<uint64_t>(_distribution.hot_fraction * static_cast<double>(_rank_count)), uint64_t{1},
+            std::max(last_rank, uint64_t{1}));
+        if (hot_count == _rank_count ||
+            std::bernoulli_distribution{_distribution.hot_probability}(random_engine)) {
+          return std::uniform_int_distribution<uint64_t>{0, hot_count - 1}(random_engine);
+        }
+        return std::uniform_int_distribution<uint64_t>{hot_count, last_rank}(random_engine);
+      }
+      case DistributionType::Normal: {
+        const auto center = static_cast<double>(last_rank) / 2.0;
+        const auto rank = std::normal_distribution<double>{
+            center, _distribution.standard_deviation * static_cast<double>(_rank_count)}(random_engine);
+        return static_cast<uint64_t>(std::clamp(std::round(rank), 0.0, static_cast<double>(last_rank)));
+      }
+    }
+    return 0;
+  }
+
+ protected:
+  // returns a rank of [1, rank_count] with a probability proportional to rank^-skew
+  template <typename RandomEngine>
+  uint64_t _zipf(RandomEngine& random_engine) const {
+    const auto exponent = _distribution.skew;
+    auto uniform = std::uniform_real_distribution<double>{0.0, 1.0};
+    while (true) {
+      const auto u = _h_integral_n + uniform(random_engine) * (_h_integral_x1 - _h_integral_n);
+      const auto x = _h_integral_inverse(u, exponent);
+      const auto k = std::clamp(std::floor(x + 0.5), 1.0, static_cast<double>(_rank_count));
+      // a rank count close to 2^64 is rounded up as double, which is out of the range of uint64_t
+      const auto rank = k >= static_cast<double>(_rank_count) ? _rank_count : static_cast<uint64_t>(k);
+      if (k - x <= _s || u >= _h_integral(k + 0.5, exponent) - _h(k, exponent)) {
+        return rank;
+      }
+    }
+  }
+
+  static double _h(const double x, const double exponent) { return std::exp(-exponent * std::log(x)); }
+
+  // the integral of _h, i.e., (x^(1 - exponent) - 1) / (1 - exponent), and log(x) for an exponent of 1
+  static double _h_integral(const double x, const double exponent) {
+    const auto log_x = std::log(x);
+    return _expm1_divided((1.0 - exponent) * log_x) * log_x;
+  }
+
+  static double _h_integral_inverse(const double x, const double exponent) {
+    const auto t = std::max(x * (1.0 - exponent), -1.0);
+    return std::exp(_log1p_divided(t) * x);
+  }
+
+  // expm1(x) / x, with its Taylor series close to 0
+  static double _expm1_divided(const double x) {
+    if (std::abs(x) > 1e-8) {
+      return std::expm1(x) / x;
+    }
+    return 1.0 + x / 2.0 * (1.0 + x / 3.0 * (1.0 + x / 4.0));
+  }
+
+  // log1p(x) / x, with its Taylor series close to 0
+  static double _log1p_divided(const double x) {
+    if (std::abs(x) > 1e-8) {
+      return std::log1p(x) / x;
+    }
+    return 1.0 - x * (1.0 / 2.0 - x * (1.0 / 3.0 - x / 4.0));
+  }
+
+  const KeyDistribution _distribution;
+  const uint64_t _rank_count;
+  double _h_integral_x1{0.0};
+  double _h_integral_n{0.0};
+  double _s{0.0};
+};
+
+}  // namespace imib
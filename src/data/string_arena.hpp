@@ -0,0 +1,40 @@
+#pragma once
+
+#include <cstddef>
+#include <span>
+#include <stdexcept>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace imib {
+
+// Stores strings back to back in one buffer instead of one allocation per string and provides views of them, e.g.,
+// for the generated string keys of the data. The views are valid as long as the arena exists.
+class StringArena final {
+ public:
+  // the strings are stored one after another in the bytes, each with the given length
+  StringArena(std::vector<char> bytes, const std::vector<size_t>& lengths) : _bytes(std::move(bytes)) {
+    _views.reserve(lengths.size());
+    auto offset = size_t{0};
+    for (const auto length : lengths) {
+      if (length > _bytes.size() - offset) {
+        throw std::logic_error("The string lengths exceed the bytes of the string arena.");
+      }
+      _views.emplace_back(_bytes.data() + offset, length);
+      offset += length;
+    }
+  }
+
+  // the views point into the bytes of this arena
+  StringArena(const StringArena&) = delete;
+  StringArena& operator=(const StringArena&) = delete;
+
+  std::span<const std::string_view> values() const { return _views; }
+
+ private:
+  const std::vector<char> _bytes;
+  std::vector<std::string_view> _views;
+};
+
+}  // namespace imib
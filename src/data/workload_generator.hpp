@@ -0,0 +1,128 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "types.hpp"
+
+namespace imib {
+
+enum class WorkloadOperationType { EqualityLookup, RangeLookup, Insert, Update };
+
+inline constexpr size_t WORKLOAD_OPERATION_TYPE_COUNT = 4;
+
+struct WorkloadOperation {
+  WorkloadOperationType type;
+  // the position of the equality or range lookup, of the entry to insert among the insert entries, or of the entry to
+  // update among the initial entries
+  size_t position;
+};
+
+// The trace of a mixed workload. The index is filled with the initial entries before the operations are executed.
+// The insert entries are the remaining entries of the data, which the insert operations insert in their order.
+template <typename Key, typename Value>
+struct Workload {
+  Entries<Key, Value> initial_entries;
+  Entries<Key, Value> insert_entries;
+  std::vector<WorkloadOperation> operations;
+};
+
+class WorkloadGenerator {
+ public:
+  WorkloadGenerator() = delete;
+
+  // Draws operation_count operations with the shares of the mix. The trace only depends on its arguments, thus, each
+  // execution of a case executes the same operations. The lookups are taken in the order of their files and start
+  // again from the first lookup if the trace contains more lookups than the files. One entry is held back from the
+  // initial entries per insert operation. The held-back entries are spread evenly over the data and inserted in a
+  // random order, i.e., the inserts do not only append to the largest keys if the data is sorted. The updated entries
+  // are drawn uniformly from the initial entries.
+  template <typename Key, typename Value>
+  static Workload<Key, Value> generate(const WorkloadMix& mix, const Entries<Key, Value>& entries,
+                                       const size_t operation_count, const size_t equality_lookup_count,
+                                       const size_t range_lookup_count) {
+    if (mix.equality_lookups + mix.range_lookups + mix.inserts + mix.updates == 0) {
+      throw std::logic_error("The workload mix '" + mix.name + "' does not contain any operation.");
+    }
+    auto random_engine = std::mt19937_64{SEED};
+    auto type_distribution = std::discrete_distribution<size_t>{
+        static_cast<double>(mix.equality_lookups), static_cast<double>(mix.range_lookups),
+        static_cast<double>(mix.inserts), static_cast<double>(mix.updates)};
+
+    auto workload = Workload<Key, Value>{};
+    workload.operations.reserve(operation_count);
+    auto counts = std::vector<size_t>(WORKLOAD_OPERATION_TYPE_COUNT);
+    for (size_t operation = 0; operation < operation_count; ++operation) {
+      const auto type = type_distribution(random_engine);
+      // the positions of the updates are drawn after the initial entries are known
+      workload.operations.push_back(WorkloadOperation{static_cast<WorkloadOperationType>(type), counts[type]});
+      ++counts[type];
+    }
+
+    const auto insert_count = counts[static_cast<size_t>(WorkloadOperationType::Insert)];
+    const auto update_count = counts[static_cast<size_t>(WorkloadOperationType::Update)];
+    if ((counts[static_cast<size_t>(WorkloadOperationType::EqualityLookup)] > 0 && equality_lookup_count == 0) ||
+        (counts[static_cast<size_t>(WorkloadOperationType::RangeLookup)] > 0 && range_lookup_count == 0)) {
+      throw std::logic_error("The workload mix '" + mix.name + "' requires lookups, but no lookups are given.");
+    }
+    if (insert_count > entries.size() || (update_count > 0 && insert_count == entries.size())) {
+      throw std::logic_error("The data contains too few entries for the workload mix '" + mix.name + "'.");
+    }
+
+    // hold back every stride-th entry for the inserts
+    const auto stride = insert_count > 0 ? entries.size() / insert_count : entries.size() + 1;
+    workload.initial_entries.reserve(entries.size() - insert_count);
+    workload.insert_entries.reserve(insert_count);
+    for (size_t position = 0; position < entries.size(); ++position) {
+      if (position % stride == 0 && workload.insert_entries.size() < insert_count) {
+        workload.insert_entries.push_back(entries[position]);
+      } else {
+        workload.initial_entries.push_back(entries[position]);
+      }
+    }
+    std::shuffle(workload.insert_entries.begin(), workload.insert_entries.end(), random_engine);
+
+    auto update_distribution = std::uniform_int_distribution<size_t>{0, workload.initial_entries.size() - 1};
+    for (auto& operation : workload.operations) {
+      switch (operation.type) {
+        case WorkloadOperationType::EqualityLookup:
+          operation.position %= equality_lookup_count;
+          break;
+        case WorkloadOperationType::RangeLookup:
+          operation.position %= range_lookup_count;
+          break;
+        case WorkloadOperationType::Insert:
+          break;
+        case WorkloadOperationType::Update:
+          operation.position = update_distribution(random_engine);
+          break;
+      }
+    }
+    return workload;
+  }
+
+  // returns the name of the operation type as exported in the result file
+  static std::string operation_name(const WorkloadOperationType type) {
+    switch (type) {
+      case WorkloadOperationType::EqualityLookup:
+        return "EqualityLookup";
+      case WorkloadOperationType::RangeLookup:
+        return "RangeLookup";
+      case WorkloadOperationType::Insert:
+        return "Insert";
+      case WorkloadOperationType::Update:
+        return "Update";
+    }
+    return "";
+  }
+
+ protected:
+  static constexpr uint64_t SEED = 42;
+};
+
+}  // namespace imib
@@ -0,0 +1,49 @@
+#include "latency_histogram.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace imib {
+
+void LatencyHistogram::merge(const LatencyHistogram& other) {
+  if (other._count == 0) {
+    return;
+  }
+  if (_counts.empty()) {
+    _counts.resize(BUCKET_COUNT);
+  }
+  for (size_t bucket = 0; bucket < BUCKET_COUNT; ++bucket) {
+    _counts[bucket] += other._counts[bucket];
+  }
+  _count += other._count;
+  _min = std::min(_min, other._min);
+  _max = std::max(_max, other._max);
+}
+
+uint64_t LatencyHistogram::percentile(const double percentile) const {
+  if (_count == 0) {
+    return 0;
+  }
+  // the rank of the value at the percentile, starting at 1
+  const auto rank = std::clamp(static_cast<uint64_t>(std::ceil(percentile / 100.0 * static_cast<double>(_count))),
+                               uint64_t{1}, _count);
+  auto cumulative_count = uint64_t{0};
+  for (size_t bucket = 0; bucket < BUCKET_COUNT; ++bucket) {
+    cumulative_count += _counts[bucket];
+    if (cumulative_count >= rank) {
+      return std::min(_highest_value(bucket), _max);
+    }
+  }
+  return _max;
+}
+
+uint64_t LatencyHistogram::_highest_value(const size_t bucket) {
+  if (bucket < SUB_BUCKET_COUNT) {
+    return bucket;
+  }
+  const auto shift = (bucket - SUB_BUCKET_COUNT) / HALF_SUB_BUCKET_COUNT + 1;
+  const auto sub_bucket = (bucket - SUB_BUCKET_COUNT) % HALF_SUB_BUCKET_COUNT + HALF_SUB_BUCKET_COUNT;
+  return (sub_bucket << shift) + ((uint64_t{1} << shift) - 1);
+}
+
+}  // namespace imib
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace imib {
+
+// Histogram of latencies in nanoseconds with a bounded relative error, similar to an HDR histogram. The values are
+// counted in log-linear buckets: the values below SUB_BUCKET_COUNT have their own bucket, and each power of two range
+// above is split into SUB_BUCKET_COUNT / 2 buckets of equal size. Thus, a percentile is at most 1 / 64 above the exact
+// value, and the histogram covers all 64-bit values with a fixed number of buckets. Recording a value is a few
+// instructions without any allocation, and histograms of multiple threads are merged by adding their counts.
+class LatencyHistogram final {
+ public:
+  LatencyHistogram() = default;
+
+  void record(const uint64_t value) {
+    if (_counts.empty()) {
+      _counts.resize(BUCKET_COUNT);
+    }
+    ++_counts[_bucket(value)];
+    ++_count;
+    _min = value < _min ? value : _min;
+    _max = value > _max ? value : _max;
+  }
+
+  void merge(const LatencyHistogram& other);
+
+  uint64_t count() const { return _count; }
+
+  // returns 0 if no value was recorded
+  uint64_t min() const { return _count > 0 ? _min : 0; }
+
+  uint64_t max() const { return _max; }
+
+  // Returns the highest value of the bucket that contains the value at the given percentile (0 to 100), but not more
+  // than the maximum value. Returns 0 if no value was recorded.
+  uint64_t percentile(const double percentile) const;
+
+ protected:
+  static constexpr uint64_t SUB_BUCKET_COUNT = 128;
+  static constexpr uint64_t HALF_SUB_BUCKET_COUNT = SUB_BUCKET_COUNT / 2;
+  static constexpr uint64_t SUB_BUCKET_BITS = static_cast<uint64_t>(std::bit_width(HALF_SUB_BUCKET_COUNT - 1));
+  // one bucket per value below SUB_BUCKET_COUNT and HALF_SUB_BUCKET_COUNT buckets for each power of two above
+  static constexpr size_t BUCKET_COUNT = SUB_BUCKET_COUNT + (64 - SUB_BUCKET_BITS - 1) * HALF_SUB_BUCKET_COUNT;
+
+  static size_t _bucket(const uint64_t value) {
+    if (value < SUB_BUCKET_COUNT) {
+      return value;
+    }
+    // the values of [2^exponent, 2^(exponent + 1)) are split into buckets of 2^shift values
+    const auto exponent = static_cast<uint64_t>(std::bit_width(value)) - 1;
+    const auto shift = exponent - SUB_BUCKET_BITS;
+    const auto sub_bucket = (value >> shift) - HALF_SUB_BUCKET_COUNT;
+    return SUB_BUCKET_COUNT + (shift - 1) * HALF_SUB_BUCKET_COUNT + sub_bucket;
+  }
+
+  static uint64_t _highest_value(const size_t bucket);
+
+  // empty until the first value is recorded, since most cases do not record latencies
+  std::vector<uint64_t> _counts;
+  uint64_t _count{0};
+  uint64_t _min{UINT64_MAX};
+  uint64_t _max{0};
+};
+
+}  // namespace imib
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <x86intrin.h>  // __rdtscp
+
+#include <chrono>
+#include <cstdint>
+
+#include "latency_histogram.hpp"
+
+namespace imib {
+
+// Records the latencies of single index operations into a histogram. The operations are timed with the time stamp
+// counter, since reading it takes a few nanoseconds instead of the tens of nanoseconds of a clock call, and rdtscp
+// waits until the previous instructions, i.e., the operation, are executed. The ticks are converted to nanoseconds
+// with the tick rate, which is calibrated once against the steady clock. This assumes an invariant time stamp
+// counter, which all recent x86 CPUs provide.
+// If recording is disabled, start() and stop() do nothing, thus, the cases do not need separate loops.
+class LatencyRecorder final {
+ public:
+  explicit LatencyRecorder(const bool enabled) : _enabled(enabled) {
+    if (_enabled) {
+      _nanoseconds_per_tick();  // calibrate before the first measurement
+    }
+  }
+
+  uint64_t start() const { return _enabled ? _ticks() : 0; }
+
+  void stop(const uint64_t start_ticks) {
+    if (_enabled) {
+      const auto ticks = _ticks() - start_ticks;
+      _histogram.record(static_cast<uint64_t>(static_cast<double>(ticks) * _nanoseconds_per_tick()));
+    }
+  }
+
+  bool enabled() const { return _enabled; }
+
+  const LatencyHistogram& histogram() const { return _histogram; }
+
+ protected:
+  static uint64_t _ticks() {
+    auto processor_id = 0u;
+    return __rdtscp(&processor_id);
+  }
+
+  static double _nanoseconds_per_tick() {
+    static const auto nanoseconds_per_tick = []() {
+      const auto begin_time = std::chrono::steady_clock::now();
+      const auto begin_ticks = _ticks();
+      while (std::chrono::steady_clock::now() - begin_time < std::chrono::milliseconds{20}) {
+        // busy wait
+      }
+      const auto ticks = _ticks() - begin_ticks;
+      const auto nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(
+          std::chrono::steady_clock::now() - begin_time);
+      return static_cast<double>(nanoseconds.count()) / static_cast<double>(ticks);
+    }();
+    return nanoseconds_per_tick;
+  }
+
+  const bool _enabled;
+  LatencyHistogram _histogram;
+};
+
+}  // namespace imib
@@ -0,0 +1,140 @@
+#include "performance_counters.hpp"
+
+#include <vector>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace imib {
+
+namespace {
+
+#ifdef __linux__
+perf_event_attr event_attributes(const HardwareEvent event) {
+  auto attributes = perf_event_attr{};
+  attributes.size = sizeof(perf_event_attr);
+  attributes.exclude_kernel = 1;
+  attributes.exclude_hv = 1;
+  attributes.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+  const auto cache_miss = [](const uint64_t cache) {
+    return cache | (uint64_t{PERF_COUNT_HW_CACHE_OP_READ} << 8) | (uint64_t{PERF_COUNT_HW_CACHE_RESULT_MISS} << 16);
+  };
+  switch (event) {
+    case HardwareEvent::Cycles:
+      attributes.type = PERF_TYPE_HARDWARE;
+      attributes.config = PERF_COUNT_HW_CPU_CYCLES;
+      break;
+    case HardwareEvent::Instructions:
+      attributes.type = PERF_TYPE_HARDWARE;
+      attributes.config = PERF_COUNT_HW_INSTRUCTIONS;
+      break;
+    case HardwareEvent::LLCMisses:
+      attributes.type = PERF_TYPE_HW_CACHE;
+      attributes.config = cache_miss(PERF_COUNT_HW_CACHE_LL);
+      break;
+    case HardwareEvent::DTLBMisses:
+      attributes.type = PERF_TYPE_HW_CACHE;
+      attributes.config = cache_miss(PERF_COUNT_HW_CACHE_DTLB);
+      break;
+    case HardwareEvent::BranchMisses:
+      attributes.type = PERF_TYPE_HARDWARE;
+      attributes.config = PERF_COUNT_HW_BRANCH_MISSES;
+      break;
+  }
+  return attributes;
+}
+#endif
+
+}  // namespace
+
+PerformanceCounters::PerformanceCounters() {
+  _file_descriptors.fill(-1);
+#ifdef __linux__
+  for (size_t event = 0; event < HARDWARE_EVENT_COUNT; ++event) {
+    auto attributes = event_attributes(static_cast<HardwareEvent>(event));
+    // only the group leader is disabled, the members are enabled and disabled with it
+    attributes.disabled = _group_file_descriptor == -1 ? 1 : 0;
+    // count the calling thread on any CPU
+    const auto file_descriptor =
+        static_cast<int>(syscall(SYS_perf_event_open, &attributes, 0, -1, _group_file_descriptor, 0));
+    if (file_descriptor == -1) {
+      continue;
+    }
+    _file_descriptors[event] = file_descriptor;
+    if (_group_file_descriptor == -1) {
+      _group_file_descriptor = file_descriptor;
+    }
+  }
+#endif
+}
+
+PerformanceCounters::~PerformanceCounters() {
+#ifdef __linux__
+  for (const auto file_descriptor : _file_descriptors) {
+    if (file_descriptor != -1) {
+      close(file_descriptor);
+    }
+  }
+#endif
+}
+
+void PerformanceCounters::start() {
+#ifdef __linux__
+  if (_group_file_descriptor != -1) {
+    ioctl(_group_file_descriptor, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+    ioctl(_group_file_descriptor, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+  }
+#endif
+}
+
+HardwareEventCounts PerformanceCounters::stop() {
+  auto counts = HardwareEventCounts{};
+#ifdef __linux__
+  if (_group_file_descriptor == -1) {
+    return counts;
+  }
+  ioctl(_group_file_descriptor, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+
+  // read format: number of events, time enabled, time running, and the values in the order the events were opened
+  auto values = std::vector<uint64_t>(3 + HARDWARE_EVENT_COUNT);
+  const auto read_bytes = read(_group_file_descriptor, values.data(), values.size() * sizeof(uint64_t));
+  const auto time_enabled = values[1];
+  const auto time_running = values[2];
+  if (read_bytes <= 0 || time_running == 0) {
+    return counts;
+  }
+  // the group was multiplexed with other events if it was not running the whole time
+  const auto scale = static_cast<double>(time_enabled) / static_cast<double>(time_running);
+  auto value_index = size_t{3};
+  for (size_t event = 0; event < HARDWARE_EVENT_COUNT; ++event) {
+    if (_file_descriptors[event] != -1) {
+      counts[event] = static_cast<uint64_t>(static_cast<double>(values[value_index]) * scale);
+      ++value_index;
+    }
+  }
+#endif
+  return counts;
+}
+
+std::string PerformanceCounters::event_name(const HardwareEvent event) {
+  switch (event) {
+    case HardwareEvent::Cycles:
+      return "cycles";
+    case HardwareEvent::Instructions:
+      return "instructions";
+    case HardwareEvent::LLCMisses:
+      return "llc_misses";
+    case HardwareEvent::DTLBMisses:
+      return "dtlb_misses";
+    case HardwareEvent::BranchMisses:
+      return "branch_misses";
+  }
+  return "";
+}
+
+}  // namespace imib
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+
+namespace imib {
+
+// the hardware events that are counted by the PerformanceCounters
+enum class HardwareEvent { Cycles, Instructions, LLCMisses, DTLBMisses, BranchMisses };
+
+inline constexpr size_t HARDWARE_EVENT_COUNT = 5;
+
+// the counts indexed by the HardwareEvent, std::nullopt if the event could not be counted
+using HardwareEventCounts = std::array<std::optional<uint64_t>, HARDWARE_EVENT_COUNT>;
+
+// Counts hardware events of the calling thread with a perf_event_open counter group, i.e., all events are counted
+// during the same time. Only the user space is counted, since an unprivileged process may not count kernel events.
+// If the CPU has fewer counters than events, the kernel multiplexes the group and the counts are scaled to the whole
+// time. If perf events are not available (e.g., on macOS, in containers without access, or in virtual machines without
+// a virtualized PMU), or an event is not supported by the CPU, the counts of the affected events are std::nullopt and
+// the benchmark continues without them.
+// The counters are opened on construction, thus, they have to be constructed by the thread to count.
+class PerformanceCounters final {
+ public:
+  PerformanceCounters();
+  PerformanceCounters(const PerformanceCounters&) = delete;
+  PerformanceCounters& operator=(const PerformanceCounters&) = delete;
+  ~PerformanceCounters();
+
+  // resets and starts the counters
+  void start();
+
+  // stops the counters and returns the counts since the last start
+  HardwareEventCounts stop();
+
+  // returns the name of the event as exported in the result file
+  static std::string event_name(const HardwareEvent event);
+
+ private:
+  // the file descriptor per event, -1 if the event could not be opened. The first opened event leads the group.
+  std::array<int, HARDWARE_EVENT_COUNT> _file_descriptors;
+  int _group_file_descriptor{-1};
+};
+
+}  // namespace imib
@@ -2,10 +2,23 @@
 
 namespace imib {
 
+namespace {
+
+void print_latencies(std::ostream& stream, const std::string& label, const LatencyHistogram& latencies) {
+  if (latencies.count() > 0) {
+    stream << "  " << label << ": p50: " << latencies.percentile(50.0) << " ns, p99: " << latencies.percentile(99.0)
+           << " ns, p99.9: " << latencies.percentile(99.9) << " ns, max: " << latencies.max() << " ns" << std::endl;
+  }
+}
+
+}  // namespace
+
 std::ostream& operator<<(std::ostream& stream, const Report& report) {
   stream << "==== Configuration ====" << std::endl
          << "iterations: " << report.benchmark_configuration.iterations << std::endl
          << "threads:    " << report.benchmark_configuration.threads << std::endl
+         << "latencies:  " << (report.benchmark_configuration.record_latencies ? "recorded" : "not recorded")
+         << std::endl
          << "======== Cases ========" << std::endl;
   for (const auto& case_stats : report.case_statistics) {
     stream << "case name:  " << case_stats.case_name << std::endl
@@ -13,12 +26,43 @@ std::ostream& operator<<(std::ostream& stream, const Report& report) {
            << "key type:   " << case_stats.key_type << std::endl
            << "value type: " << case_stats.value_type << std::endl
            << "data size:" << case_stats.data_size << std::endl
+           << "data file:  " << case_stats.data_file << std::endl
            << "executions: " << std::endl;
     for (const auto& execution : case_stats.executions) {
       stream << "  measurements:" << std::endl;
       for (const auto& measurement : execution.measurements) {
         stream << "    duration: " << measurement.duration.count() << " ns, "
-               << "index size: " << measurement.index_size_bytes << " bytes" << std::endl;
+               << "index size: " << measurement.index_size_bytes << " bytes";
+        for (size_t event = 0; event < HARDWARE_EVENT_COUNT; ++event) {
+          const auto events_per_operation = measurement.events_per_operation(static_cast<HardwareEvent>(event));
+          if (events_per_operation) {
+            stream << ", " << PerformanceCounters::event_name(static_cast<HardwareEvent>(event))
+                   << "/op: " << *events_per_operation;
+          }
+        }
+        stream << std::endl;
+      }
+      if (execution.throughput() > 0.0) {
+        stream << "  throughput: " << execution.throughput() << " ops/s" << std::endl;
+      }
+      if (execution.result_count > 0) {
+        stream << "  result count: " << execution.result_count << std::endl;
+      }
+      if (execution.freed_bytes > 0) {
+        stream << "  freed memory: " << execution.freed_bytes << " bytes" << std::endl;
+      }
+      const auto& series = execution.throughput_series;
+      if (!series.operations_per_second.empty()) {
+        stream << "  throughput per " << series.bucket_duration.count() << " ms (ops/s, the first "
+               << series.warm_up_bucket_count << " of warm-up):";
+        for (const auto operations_per_second : series.operations_per_second) {
+          stream << " " << operations_per_second;
+        }
+        stream << std::endl;
+      }
+      print_latencies(stream, "latencies", execution.latencies);
+      for (const auto& [operation_name, operation_latencies] : execution.operation_latencies) {
+        print_latencies(stream, operation_name + " latencies", operation_latencies);
       }
     }
     stream << "-----------------------" << std::endl;
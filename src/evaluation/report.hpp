@@ -1,10 +1,17 @@
 #pragma once
 
+#include <algorithm>
 #include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <optional>
 #include <ostream>
 #include <string>
 #include <vector>
 
+#include "latency_histogram.hpp"
+#include "performance_counters.hpp"
 #include "types.hpp"
 
 namespace imib {
@@ -12,14 +19,65 @@ namespace imib {
 struct Measurements {
   std::chrono::nanoseconds duration;
   uint64_t index_size_bytes;
+  // the number of index operations (or entries of a bulk operation) that the event counts are normalized by
+  uint64_t operation_count{0};
+  HardwareEventCounts event_counts{};
 
   Measurements() = default;
   Measurements(const std::chrono::nanoseconds& p_duration, const uint64_t p_index_size_bytes)
       : duration(p_duration), index_size_bytes(p_index_size_bytes) {}
+  Measurements(const std::chrono::nanoseconds& p_duration, const uint64_t p_index_size_bytes,
+               const uint64_t p_operation_count, const HardwareEventCounts& p_event_counts)
+      : duration(p_duration),
+        index_size_bytes(p_index_size_bytes),
+        operation_count(p_operation_count),
+        event_counts(p_event_counts) {}
+
+  // returns std::nullopt if the event was not counted
+  std::optional<double> events_per_operation(const HardwareEvent event) const {
+    const auto& count = event_counts[static_cast<size_t>(event)];
+    if (!count || operation_count == 0) {
+      return std::nullopt;
+    }
+    return static_cast<double>(*count) / static_cast<double>(operation_count);
+  }
+};
+
+// the throughput of all threads per time bucket of a time-bounded execution
+struct ThroughputSeries {
+  std::chrono::milliseconds bucket_duration{0};
+  // the first buckets contain the operations of the warm-up
+  size_t warm_up_bucket_count{0};
+  std::vector<double> operations_per_second;
 };
 
 struct ExecutionStatistics {
   std::vector<Measurements> measurements;
+  // the latencies of the single index operations of all threads, only recorded on request
+  LatencyHistogram latencies;
+  // the latencies by operation type for the cases that execute different operations, e.g., the mixed workloads
+  std::map<std::string, LatencyHistogram> operation_latencies;
+  // only for time-bounded executions
+  ThroughputSeries throughput_series;
+  // the number of values that the lookups return, each lookup counted once, only for the cases on key duplicates
+  uint64_t result_count{0};
+  // the memory that the index returned to the allocator, only for the BulkErase case
+  uint64_t freed_bytes{0};
+
+  // Returns the operations per second of all threads, i.e., the operations of all measurements divided by the longest
+  // duration. Returns 0 if no operations were counted.
+  double throughput() const {
+    auto operation_count = uint64_t{0};
+    auto duration = std::chrono::nanoseconds{0};
+    for (const auto& measurement : measurements) {
+      operation_count += measurement.operation_count;
+      duration = std::max(duration, measurement.duration);
+    }
+    if (operation_count == 0 || duration.count() == 0) {
+      return 0.0;
+    }
+    return static_cast<double>(operation_count) / std::chrono::duration<double>(duration).count();
+  }
 };
 
 struct BenchmarkCaseStatistics {
@@ -28,6 +86,7 @@ struct BenchmarkCaseStatistics {
   std::string key_type;
   std::string value_type;
   size_t data_size;
+  std::string data_file;
   std::vector<ExecutionStatistics> executions;
 };
 
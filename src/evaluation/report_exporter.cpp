@@ -7,10 +7,42 @@
 
 #include "nlohmann/json.hpp"
 
+#include "data/random_key_generator.hpp"
+#include "performance_counters.hpp"
 #include "report.hpp"
 
 namespace imib {
 
+namespace {
+
+nlohmann::json latency_percentiles(const LatencyHistogram& latencies) {
+  return nlohmann::json{{"operation_count", latencies.count()},
+                        {"min_ns", latencies.min()},
+                        {"p50_ns", latencies.percentile(50.0)},
+                        {"p90_ns", latencies.percentile(90.0)},
+                        {"p99_ns", latencies.percentile(99.0)},
+                        {"p99_9_ns", latencies.percentile(99.9)},
+                        {"p99_99_ns", latencies.percentile(99.99)},
+                        {"max_ns", latencies.max()}};
+}
+
+// returns the file name, or the distribution including its seed if the keys or lookups were generated
+nlohmann::json keys_source(const std::string& file_name, const KeyDistribution& distribution) {
+  if (!file_name.empty()) {
+    return file_name;
+  }
+  return nlohmann::json{{"distribution", RandomKeyGenerator::distribution_name(distribution.type)},
+                        {"count", distribution.count},
+                        {"seed", distribution.seed},
+                        {"skew", distribution.skew},
+                        {"hot_probability", distribution.hot_probability},
+                        {"hot_fraction", distribution.hot_fraction},
+                        {"standard_deviation", distribution.standard_deviation},
+                        {"distinct_count", distribution.distinct_count}};
+}
+
+}  // namespace
+
 ReportExporter::ReportExporter(const Report& report, const std::string& output_file_path, const OutputType output_type)
     : _report(report), _output_file_path(output_file_path), _output_type(output_type) {
   assert(_output_type == OutputType::Json);  // Only Json files can be exported for now.
@@ -20,26 +52,97 @@ void ReportExporter::execute() const {
   std::ofstream output_file(_output_file_path);
 
   nlohmann::json json_report;
-  json_report["configuration"] = nlohmann::json{{"iterations", _report.benchmark_configuration.iterations},
-                                                {"threads", _report.benchmark_configuration.threads}};
+  json_report["configuration"] =
+      nlohmann::json{{"iterations", _report.benchmark_configuration.iterations},
+                     {"threads", _report.benchmark_configuration.threads},
+                     {"record_latencies", _report.benchmark_configuration.record_latencies}};
+  auto json_datasets = nlohmann::json::array();
+  for (const auto& dataset : _report.benchmark_configuration.datasets) {
+    auto json_range_lookups = keys_source(dataset.range_lookup_file, dataset.range_lookup_distribution);
+    if (dataset.range_lookup_file.empty()) {
+      json_range_lookups["range_size"] = dataset.range_lookup_size;
+    }
+    json_datasets.push_back(
+        {{"data", keys_source(dataset.data_file, dataset.key_distribution)},
+         {"equality_lookups", keys_source(dataset.equality_lookup_file, dataset.equality_lookup_distribution)},
+         {"range_lookups", json_range_lookups}});
+  }
+  json_report["configuration"]["datasets"] = json_datasets;
+  const auto& time_bound = _report.benchmark_configuration.time_bound;
+  if (time_bound.enabled()) {
+    json_report["configuration"]["time_bound"] = {{"duration_ms", time_bound.duration.count()},
+                                                  {"warm_up_ms", time_bound.warm_up.count()},
+                                                  {"bucket_ms", time_bound.bucket_duration.count()},
+                                                  {"target_relative_error", time_bound.target_relative_error}};
+  }
 
   auto json_cases = nlohmann::json::array();
   for (const auto& case_stats : _report.case_statistics) {
     auto json_executions = nlohmann::json::array();
+    auto json_latencies = nlohmann::json::array();
+    auto json_operation_latencies = nlohmann::json::array();
     for (const auto& execution : case_stats.executions) {
       auto json_measurements = nlohmann::json::array();  // multiple measurements could be saved in one execution
       for (const auto& measurement : execution.measurements) {
-        json_measurements.push_back(
-            {{"duration_ns", measurement.duration.count()}, {"index_size_bytes", measurement.index_size_bytes}});
+        auto json_measurement = nlohmann::json{{"duration_ns", measurement.duration.count()},
+                                               {"index_size_bytes", measurement.index_size_bytes},
+                                               {"operation_count", measurement.operation_count}};
+        // only the events that were counted, normalized by the operation count of the measurement
+        auto json_events = nlohmann::json::object();
+        for (size_t event = 0; event < HARDWARE_EVENT_COUNT; ++event) {
+          const auto events_per_operation = measurement.events_per_operation(static_cast<HardwareEvent>(event));
+          if (events_per_operation) {
+            json_events[PerformanceCounters::event_name(static_cast<HardwareEvent>(event))] = *events_per_operation;
+          }
+        }
+        if (!json_events.empty()) {
+          json_measurement["events_per_operation"] = json_events;
+        }
+        json_measurements.push_back(json_measurement);
+      }
+      auto json_execution = nlohmann::json{{"measurements", json_measurements}};
+      if (execution.throughput() > 0.0) {
+        json_execution["throughput_ops_per_s"] = execution.throughput();
+      }
+      if (execution.result_count > 0) {
+        json_execution["result_count"] = execution.result_count;
+      }
+      if (execution.freed_bytes > 0) {
+        json_execution["freed_bytes"] = execution.freed_bytes;
+      }
+      const auto& series = execution.throughput_series;
+      if (!series.operations_per_second.empty()) {
+        json_execution["throughput_series"] = {{"bucket_ms", series.bucket_duration.count()},
+                                               {"warm_up_buckets", series.warm_up_bucket_count},
+                                               {"operations_per_second", series.operations_per_second}};
       }
-      json_executions.push_back({"measurements", json_measurements});
+      json_executions.push_back(json_execution);
+      // the percentiles of the operation latencies of the execution, in the order of the executions
+      if (execution.latencies.count() > 0) {
+        json_latencies.push_back(latency_percentiles(execution.latencies));
+      }
+      if (!execution.operation_latencies.empty()) {
+        auto json_execution_operation_latencies = nlohmann::json::object();
+        for (const auto& [operation_name, latencies] : execution.operation_latencies) {
+          json_execution_operation_latencies[operation_name] = latency_percentiles(latencies);
+        }
+        json_operation_latencies.push_back(json_execution_operation_latencies);
+      }
+    }
+    auto json_case = nlohmann::json{{"case_name", case_stats.case_name},
+                                    {"index_name", case_stats.index_name},
+                                    {"key_type", case_stats.key_type},
+                                    {"value_type", case_stats.value_type},
+                                    {"data_size", case_stats.data_size},
+                                    {"data_file", case_stats.data_file},
+                                    {"executions", json_executions}};
+    if (!json_latencies.empty()) {
+      json_case["latencies"] = json_latencies;
+    }
+    if (!json_operation_latencies.empty()) {
+      json_case["operation_latencies"] = json_operation_latencies;
     }
-    json_cases.push_back(nlohmann::json{{"case_name", case_stats.case_name},
-                                        {"index_name", case_stats.index_name},
-                                        {"key_type", case_stats.key_type},
-                                        {"value_type", case_stats.value_type},
-                                        {"data_size", case_stats.data_size},
-                                        {"executions", json_executions}});
+    json_cases.push_back(json_case);
   }
   json_report["cases"] = json_cases;
 
@@ -0,0 +1,68 @@
+#include "throughput_monitor.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace imib {
+
+ThroughputMonitor::ThroughputMonitor(const TimeBound& time_bound)
+    : _time_bound(time_bound),
+      _operation_counts((time_bound.warm_up + time_bound.duration + time_bound.bucket_duration -
+                         std::chrono::milliseconds{1}) /
+                        time_bound.bucket_duration) {
+  // do nothing
+}
+
+bool ThroughputMonitor::converged(const std::chrono::nanoseconds elapsed) const {
+  if (_time_bound.target_relative_error <= 0.0) {
+    return false;
+  }
+  const auto first_bucket = _warm_up_bucket_count();
+  const auto end_bucket =
+      std::min(static_cast<size_t>(elapsed / _time_bound.bucket_duration), _operation_counts.size());
+  if (end_bucket < first_bucket + MIN_BUCKET_COUNT) {
+    return false;
+  }
+
+  // the buckets have the same duration, thus, the operation counts are compared instead of the throughputs
+  const auto bucket_count = static_cast<double>(end_bucket - first_bucket);
+  auto sum = 0.0;
+  for (auto bucket = first_bucket; bucket < end_bucket; ++bucket) {
+    sum += static_cast<double>(_operation_counts[bucket].load(std::memory_order_relaxed));
+  }
+  const auto mean = sum / bucket_count;
+  auto squared_deviations = 0.0;
+  for (auto bucket = first_bucket; bucket < end_bucket; ++bucket) {
+    const auto deviation = static_cast<double>(_operation_counts[bucket].load(std::memory_order_relaxed)) - mean;
+    squared_deviations += deviation * deviation;
+  }
+  const auto standard_deviation = std::sqrt(squared_deviations / (bucket_count - 1.0));
+  // half-width of the confidence interval with the normal approximation
+  const auto half_width = 1.96 * standard_deviation / std::sqrt(bucket_count);
+  return mean > 0.0 && half_width <= _time_bound.target_relative_error * mean;
+}
+
+ThroughputSeries ThroughputMonitor::series(const std::chrono::nanoseconds elapsed) const {
+  auto series = ThroughputSeries{_time_bound.bucket_duration, _warm_up_bucket_count(), {}};
+  const auto bucket_duration = std::chrono::nanoseconds{_time_bound.bucket_duration};
+  for (size_t bucket = 0; bucket < _operation_counts.size(); ++bucket) {
+    const auto bucket_begin = bucket_duration * static_cast<int64_t>(bucket);
+    if (bucket_begin >= elapsed) {
+      break;
+    }
+    const auto duration = std::min(bucket_duration, elapsed - bucket_begin);
+    series.operations_per_second.push_back(
+        static_cast<double>(_operation_counts[bucket].load(std::memory_order_relaxed)) /
+        std::chrono::duration<double>(duration).count());
+  }
+  series.warm_up_bucket_count = std::min(series.warm_up_bucket_count, series.operations_per_second.size());
+  return series;
+}
+
+size_t ThroughputMonitor::_warm_up_bucket_count() const {
+  // a bucket that contains the end of the warm-up counts as warm-up
+  return static_cast<size_t>((_time_bound.warm_up + _time_bound.bucket_duration - std::chrono::milliseconds{1}) /
+                             _time_bound.bucket_duration);
+}
+
+}  // namespace imib
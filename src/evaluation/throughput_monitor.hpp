@@ -0,0 +1,46 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "report.hpp"
+#include "types.hpp"
+
+namespace imib {
+
+// Counts the operations of a time-bounded execution per time bucket. The threads add their operations after each
+// chunk of operations to the bucket in which the chunk ended, thus, a bucket should be much longer than a chunk. The
+// time is measured by each thread since its start, which all threads pass at the same time.
+class ThroughputMonitor final {
+ public:
+  explicit ThroughputMonitor(const TimeBound& time_bound);
+
+  // adds the operations that ended after the elapsed time, operations after the end of the time bound are ignored
+  void add(const std::chrono::nanoseconds elapsed, const uint64_t operation_count) {
+    const auto bucket = static_cast<size_t>(elapsed / _time_bound.bucket_duration);
+    if (bucket < _operation_counts.size()) {
+      _operation_counts[bucket].fetch_add(operation_count, std::memory_order_relaxed);
+    }
+  }
+
+  // Returns whether the 95% confidence interval of the throughput of the complete buckets after the warm-up is
+  // narrower than the target relative error of the time bound. At least MIN_BUCKET_COUNT buckets are required, and
+  // false is returned if no target is given.
+  bool converged(const std::chrono::nanoseconds elapsed) const;
+
+  // returns the throughput of each bucket until the elapsed time, the last bucket may be shorter than the others
+  ThroughputSeries series(const std::chrono::nanoseconds elapsed) const;
+
+ protected:
+  static constexpr size_t MIN_BUCKET_COUNT = 10;
+
+  size_t _warm_up_bucket_count() const;
+
+  const TimeBound _time_bound;
+  std::vector<std::atomic<uint64_t>> _operation_counts;
+};
+
+}  // namespace imib
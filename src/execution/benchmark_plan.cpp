@@ -0,0 +1,210 @@
+#include "benchmark_plan.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <initializer_list>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "nlohmann/json.hpp"
+
+#include "data/random_key_generator.hpp"
+
+namespace imib {
+
+namespace {
+
+const nlohmann::json& required_field(const nlohmann::json& object, const std::string& field_name,
+                                     const std::string& context) {
+  if (!object.is_object() || !object.contains(field_name)) {
+    throw std::logic_error(context + " does not contain '" + field_name + "'.");
+  }
+  return object[field_name];
+}
+
+// Parses a key distribution, e.g., {"distribution": "zipfian", "count": 1000000, "skew": 0.99, "seed": 42}. Without
+// seed, a random seed is drawn, which is exported with the result.
+KeyDistribution parse_distribution(const nlohmann::json& json_distribution, const std::string& context) {
+  auto distribution = KeyDistribution{};
+  const auto distribution_name = required_field(json_distribution, "distribution", context).get<std::string>();
+  distribution.type = RandomKeyGenerator::distribution_type(distribution_name);
+  distribution.count = required_field(json_distribution, "count", context).get<size_t>();
+  distribution.seed = json_distribution.contains("seed") ? json_distribution["seed"].get<uint64_t>()
+                                                         : std::random_device{}();
+  distribution.skew = json_distribution.value("skew", distribution.skew);
+  distribution.hot_probability = json_distribution.value("hot_probability", distribution.hot_probability);
+  distribution.hot_fraction = json_distribution.value("hot_fraction", distribution.hot_fraction);
+  distribution.standard_deviation = json_distribution.value("standard_deviation", distribution.standard_deviation);
+  distribution.distinct_count = json_distribution.value("distinct_count", distribution.distinct_count);
+  return distribution;
+}
+
+}  // namespace
+
+BenchmarkConfiguration BenchmarkPlan::parse(const std::string& plan) {
+  const auto json_plan = nlohmann::json::parse(plan);
+
+  auto config = BenchmarkConfiguration{};
+  config.iterations = json_plan.value("iterations", size_t{1});
+  config.threads = json_plan.value("threads", size_t{1});
+  config.key_types = required_field(json_plan, "key_types", "The benchmark plan").get<std::vector<std::string>>();
+  config.output_file_name = json_plan.value("result_file_prefix", std::string{});
+  config.record_latencies = json_plan.value("record_latencies", false);
+
+  // the keys and lookups of a dataset are either the name of a file or a distribution to generate them from
+  for (const auto& json_dataset : required_field(json_plan, "datasets", "The benchmark plan")) {
+    auto dataset = DatasetConfiguration{};
+    const auto& json_data = required_field(json_dataset, "data", "A dataset");
+    if (json_data.is_string()) {
+      dataset.data_file = json_data.get<std::string>();
+    } else {
+      dataset.key_distribution = parse_distribution(json_data, "The data of a dataset");
+    }
+    const auto& json_equality_lookups = required_field(json_dataset, "equality_lookups", "A dataset");
+    if (json_equality_lookups.is_string()) {
+      dataset.equality_lookup_file = json_equality_lookups.get<std::string>();
+    } else {
+      dataset.equality_lookup_distribution =
+          parse_distribution(json_equality_lookups, "The equality lookups of a dataset");
+    }
+    const auto& json_range_lookups = required_field(json_dataset, "range_lookups", "A dataset");
+    if (json_range_lookups.is_string()) {
+      dataset.range_lookup_file = json_range_lookups.get<std::string>();
+    } else {
+      dataset.range_lookup_distribution = parse_distribution(json_range_lookups, "The range lookups of a dataset");
+      dataset.range_lookup_size = json_range_lookups.value("range_size", dataset.range_lookup_size);
+    }
+    dataset.populate = json_dataset.value("populate", dataset.populate);
+    dataset.huge_pages = json_dataset.value("huge_pages", dataset.huge_pages);
+    config.datasets.push_back(std::move(dataset));
+  }
+
+  if (!json_plan.contains("workload_mixes")) {
+    config.workload_mixes = default_workload_mixes();
+  }
+  for (const auto& json_mix : json_plan.value("workload_mixes", nlohmann::json::array())) {
+    auto mix = WorkloadMix{required_field(json_mix, "name", "A workload mix").get<std::string>(),
+                           json_mix.value("equality_lookups", uint32_t{0}),
+                           json_mix.value("range_lookups", uint32_t{0}), json_mix.value("inserts", uint32_t{0}),
+                           json_mix.value("updates", uint32_t{0})};
+    if (mix.equality_lookups + mix.range_lookups + mix.inserts + mix.updates == 0) {
+      throw std::logic_error("The workload mix '" + mix.name + "' does not contain any operation.");
+    }
+    for (const auto& other_mix : config.workload_mixes) {
+      if (other_mix.name == mix.name) {
+        throw std::logic_error("The workload mix '" + mix.name + "' is defined twice.");
+      }
+    }
+    config.workload_mixes.push_back(std::move(mix));
+  }
+
+  config.bulk_erase_fraction = json_plan.value("bulk_erase_fraction", config.bulk_erase_fraction);
+  if (config.bulk_erase_fraction <= 0.0 || config.bulk_erase_fraction > 1.0) {
+    throw std::logic_error("The bulk erase fraction has to be in (0, 1].");
+  }
+
+  if (json_plan.contains("time_bound")) {
+    const auto& json_time_bound = json_plan["time_bound"];
+    auto& time_bound = config.time_bound;
+    time_bound.duration =
+        std::chrono::milliseconds{required_field(json_time_bound, "duration_ms", "The time bound").get<int64_t>()};
+    time_bound.warm_up = std::chrono::milliseconds{json_time_bound.value("warm_up_ms", int64_t{0})};
+    time_bound.bucket_duration =
+        std::chrono::milliseconds{json_time_bound.value("bucket_ms", time_bound.bucket_duration.count())};
+    time_bound.target_relative_error =
+        json_time_bound.value("target_relative_error", time_bound.target_relative_error);
+    if (time_bound.duration.count() <= 0 || time_bound.bucket_duration.count() <= 0) {
+      throw std::logic_error("The time bound requires a positive duration_ms and bucket_ms.");
+    }
+    if (time_bound.warm_up.count() < 0 || time_bound.target_relative_error < 0.0) {
+      throw std::logic_error("The warm_up_ms and target_relative_error of the time bound must not be negative.");
+    }
+  }
+
+  if (!json_plan.contains("cases")) {
+    config.cases = default_cases(config.workload_mixes);
+    return config;
+  }
+  for (const auto& json_case : json_plan["cases"]) {
+    config.cases.push_back(CaseSelection{required_field(json_case, "case", "A case selection").get<std::string>(),
+                                         json_case.value("indexes", std::vector<std::string>{})});
+  }
+  return config;
+}
+
+BenchmarkConfiguration BenchmarkPlan::load(const std::string& file_path) {
+  auto plan_file = std::ifstream{file_path};
+  if (!plan_file) {
+    throw std::logic_error("Opening " + file_path + " failed.");
+  }
+  auto plan = std::ostringstream{};
+  plan << plan_file.rdbuf();
+  return parse(plan.str());
+}
+
+std::vector<CaseSelection> BenchmarkPlan::default_cases(const std::vector<WorkloadMix>& workload_mixes) {
+  // Measurements on small data sets show that the SkipList and the lookups of the SimpleVector are very slow. The
+  // single inserts and erases of the sorted arrays take an incredibly long time. Based on the competitor binary tests,
+  // the erase of the Unsync ART is faulty.
+  const auto hash_maps =
+      std::vector<std::string>{"RH Flat Map",         "RH Node Map",           "TSL Robin Map", "TSL Sparse Map",
+                               "Sharded RH Flat Map", "Sharded TSL Robin Map", "STD Hash Map"};
+  const auto sorted_arrays = std::vector<std::string>{"Columnar Sorted Vector", "SIMD Sorted Vector", "Sorted Vector"};
+  const auto trees = std::vector<std::string>{"Abseil B-Tree", "TLX B+ Tree", "Open Bw-Tree", "Masstree"};
+  const auto read_optimized = std::vector<std::string>{"CSSL", "Eytzinger Array", "PLA Index"};
+  // the variants that store key duplicates in addition to the sorted arrays and read-optimized indexes
+  const auto duplicate_indexes = std::vector<std::string>{"Unsync ART Posting List", "Abseil B-Tree Multimap",
+                                                          "TLX B+ Tree Multimap", "RH Posting List Map"};
+
+  const auto concatenate = [](std::initializer_list<std::vector<std::string>> name_lists) {
+    auto names = std::vector<std::string>{};
+    for (const auto& name_list : name_lists) {
+      names.insert(names.end(), name_list.begin(), name_list.end());
+    }
+    return names;
+  };
+
+  const auto lookup_indexes =
+      concatenate({{"Unsync ART", "OLC ART", "Ref ART", "MP Judy"}, trees, hash_maps, sorted_arrays, read_optimized});
+  auto cases = std::vector<CaseSelection>{
+      {"BulkLoad", {"TLX B+ Tree", "Partitioned TLX B+ Tree", "CSSL", "Eytzinger Array", "PLA Index"}},
+      {"BulkInsert", concatenate({{"Abseil B-Tree", "TLX B+ Tree"}, hash_maps, sorted_arrays, {"Simple Vector"}})},
+      {"EqualityLookup", lookup_indexes},
+      {"BufferedEqualityLookup", lookup_indexes},
+      {"BatchedEqualityLookup",
+       {"Eytzinger Array", "Sorted Vector", "STD Hash Map", "Sharded RH Flat Map", "Sharded TSL Robin Map"}},
+      {"DuplicateEqualityLookup", concatenate({duplicate_indexes, sorted_arrays, read_optimized})},
+      {"RangeLookup", concatenate({{"OLC ART", "Ref ART"}, trees, sorted_arrays, read_optimized})},
+      {"Insert", concatenate({{"Unsync ART", "OLC ART", "Ref ART", "MP Judy"}, trees, hash_maps, {"Simple Vector"}})},
+      {"Erase", concatenate({{"OLC ART", "Ref ART", "MP Judy"}, trees, hash_maps})},
+      {"BulkErase", {"Abseil B-Tree", "TLX B+ Tree", "Sorted Vector", "RH Flat Map", "RH Node Map", "TSL Robin Map",
+                     "TSL Sparse Map", "STD Hash Map"}},
+  };
+
+  // the mixes are executed by the indexes whose inserts and erases are thread-safe, the sharded hash maps have no
+  // range lookups
+  const auto concurrent_indexes = std::vector<std::string>{"OLC ART", "Open Bw-Tree", "Masstree"};
+  const auto sharded_hash_maps = std::vector<std::string>{"Sharded RH Flat Map", "Sharded TSL Robin Map"};
+  for (const auto& mix : workload_mixes) {
+    const auto& mix_indexes =
+        mix.range_lookups > 0 ? concurrent_indexes : concatenate({concurrent_indexes, sharded_hash_maps});
+    cases.push_back({"MixedWorkload(" + mix.name + ")", mix_indexes});
+  }
+  return cases;
+}
+
+std::vector<WorkloadMix> BenchmarkPlan::default_workload_mixes() {
+  return {
+      {"UpdateHeavy", 50, 0, 0, 50},
+      {"ReadMostly", 95, 0, 0, 5},
+      {"ReadInsert", 95, 0, 5, 0},
+      {"ScanInsert", 0, 95, 5, 0},
+  };
+}
+
+}  // namespace imib
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "types.hpp"
+
+namespace imib {
+
+// Reads the benchmark configuration from a JSON benchmark plan, for example:
+// {
+//   "iterations": 3,
+//   "threads": 1,
+//   "key_types": ["uint32_t", "uint64_t"],
+//   "datasets": [{"data": "<file>", "equality_lookups": "<file>", "range_lookups": "<file>"}],
+//   "cases": [{"case": "RangeLookup", "indexes": ["TLX B+ Tree", "Masstree", "Sorted Vector"]}, {"case": "Insert"}],
+//   "result_file_prefix": "<prefix>",
+//   "record_latencies": true,
+//   "workload_mixes": [{"name": "ReadMostly", "equality_lookups": 95, "updates": 5}],
+//   "time_bound": {"duration_ms": 10000, "warm_up_ms": 1000, "bucket_ms": 100, "target_relative_error": 0.01},
+//   "bulk_erase_fraction": 0.1
+// }
+// The iterations and threads default to 1. Without cases, the default cases are executed. Without result file prefix,
+// the result is printed. The latencies of the single index operations are only recorded if record_latencies is true.
+// The case and index names are the names of the benchmark cases and competitors. Each workload mix is selected as
+// case "MixedWorkload(<name>)". The shares of the operations that a mix omits are 0. Without workload mixes, the
+// default workload mixes are used. With a time bound, each case executes its operations for the duration after the
+// warm-up (see TimeBound), and the throughput is reported per bucket. The warm-up and target relative error default to
+// 0, the bucket to 100 ms. A generated dataset with "distinct_count" contains key duplicates (see KeyDistribution).
+// The key types are "uint32_t", "uint64_t", and "string", whose files are read with MappedStringFile. The BulkErase
+// case erases the bulk erase fraction of the entries, 0.1 by default.
+class BenchmarkPlan {
+ public:
+  BenchmarkPlan() = delete;
+
+  // the output file name of the returned configuration is the result file prefix of the plan
+  static BenchmarkConfiguration parse(const std::string& plan);
+
+  static BenchmarkConfiguration load(const std::string& file_path);
+
+  // the cases that are executed if the plan does not select any cases, i.e., the competitors whose execution does not
+  // take an incredibly long time or is not faulty, including a MixedWorkload case per workload mix
+  static std::vector<CaseSelection> default_cases(
+      const std::vector<WorkloadMix>& workload_mixes = default_workload_mixes());
+
+  // mixes similar to the YCSB core workloads A (update heavy), B (read mostly), D (read latest), and E (short ranges)
+  static std::vector<WorkloadMix> default_workload_mixes();
+};
+
+}  // namespace imib
@@ -0,0 +1,175 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include "competitors/art.hpp"
+#include "competitors/art_olc.hpp"
+#include "competitors/art_posting_list.hpp"
+#include "competitors/art_reference.hpp"
+#include "competitors/b_tree_google_abseil.hpp"
+#include "competitors/b_tree_google_abseil_multimap.hpp"
+#include "competitors/b_tree_tlx.hpp"
+#include "competitors/b_tree_tlx_multimap.hpp"
+#include "competitors/b_tree_tlx_partitioned.hpp"
+#include "competitors/bw_tree.hpp"
+#include "competitors/columnar_sorted_vector.hpp"
+#include "competitors/cssl.hpp"
+#include "competitors/eytzinger_array.hpp"
+#include "competitors/hash_map_robin_hood_flat.hpp"
+#include "competitors/hash_map_robin_hood_node.hpp"
+#include "competitors/hash_map_robin_hood_posting_list.hpp"
+#include "competitors/hash_map_tsl_robin.hpp"
+#include "competitors/hash_map_tsl_sparse.hpp"
+#include "competitors/judy.hpp"
+#include "competitors/masstree.hpp"
+#include "competitors/piecewise_linear_index.hpp"
+#include "competitors/sharded_hash_map.hpp"
+#include "competitors/simd_sorted_vector.hpp"
+#include "competitors/simple_vector.hpp"
+#include "competitors/skip_list.hpp"
+#include "competitors/sorted_vector.hpp"
+#include "competitors/unordered_map.hpp"
+#include "execution/cases/base_benchmark_case.hpp"
+#include "execution/cases/case_batched_equality_lookup.hpp"
+#include "execution/cases/case_buffered_equality_lookup.hpp"
+#include "execution/cases/case_bulk_erase.hpp"
+#include "execution/cases/case_bulk_insert.hpp"
+#include "execution/cases/case_bulk_load.hpp"
+#include "execution/cases/case_duplicate_equality_lookup.hpp"
+#include "execution/cases/case_equality_lookup.hpp"
+#include "execution/cases/case_erase.hpp"
+#include "execution/cases/case_insert.hpp"
+#include "execution/cases/case_mixed_workload.hpp"
+#include "execution/cases/case_range_lookup.hpp"
+#include "types.hpp"
+
+namespace imib {
+
+template <typename Key, typename Value>
+using ShardedRobinHoodFlatMap = ShardedHashMap<HashMapRobinHoodFlat, Key, Value>;
+
+template <typename Key, typename Value>
+using ShardedTslRobinMap = ShardedHashMap<HashMapTslRobin, Key, Value>;
+
+// Compile-time registry of the benchmark cases and the competitors. The cases are instantiated for each registered
+// competitor that supports their operation, and the benchmark plan selects the ones to execute by their names at
+// runtime. Thus, adding a case or a competitor only requires to register its template here.
+// The BBTree is not registered since it only stores uint32_t values and its range lookup is faulty (see the
+// competitor binary tests). If the data contains key duplicates, only the competitors that store them are registered.
+// String keys (std::string_view) are only registered for the ARTs, the B-trees, the hash maps, and the vectors, since
+// the other competitors rely on fixed-size keys, e.g., for SIMD searches or key arithmetic.
+template <typename Key, typename Value>
+class BenchmarkRegistry {
+ public:
+  BenchmarkRegistry() = delete;
+
+  // returns whether a created case is kept, e.g., whether the benchmark plan selects it
+  using CaseFilter = std::function<bool(const BaseBenchmarkCase&)>;
+
+  // The cases keep references to the data and the lookups, thus, they have to outlive the cases. A MixedWorkload case
+  // is created for each workload mix. The BulkErase case erases the bulk erase fraction of the entries.
+  // Only the cases that pass the filter are checked against the data, thus, whether the keys are unique is only
+  // computed if a kept case's competitor requires unique keys.
+  static std::vector<std::shared_ptr<BaseBenchmarkCase>> create_cases(
+      const Data<Key, Value>& data, const std::vector<EqualityLookup<Key>>& equality_lookups,
+      const std::vector<RangeLookup<Key>>& range_lookups, const std::vector<WorkloadMix>& workload_mixes,
+      const double bulk_erase_fraction, const CaseFilter& filter = nullptr) {
+    auto cases = std::vector<std::shared_ptr<BaseBenchmarkCase>>{};
+    _add_cases<CaseBulkLoad, CaseBulkInsert, CaseBulkErase, CaseEqualityLookup, CaseBufferedEqualityLookup,
+               CaseBatchedEqualityLookup, CaseDuplicateEqualityLookup, CaseRangeLookup, CaseInsert, CaseErase,
+               CaseMixedWorkload>(cases, data, equality_lookups, range_lookups, workload_mixes, bulk_erase_fraction,
+                                  filter);
+    return cases;
+  }
+
+ protected:
+  template <template <typename, typename, typename> class... Cases>
+  static void _add_cases(std::vector<std::shared_ptr<BaseBenchmarkCase>>& cases, const Data<Key, Value>& data,
+                         const std::vector<EqualityLookup<Key>>& equality_lookups,
+                         const std::vector<RangeLookup<Key>>& range_lookups,
+                         const std::vector<WorkloadMix>& workload_mixes, const double bulk_erase_fraction,
+                         const CaseFilter& filter) {
+    (_add_indexes<Cases, Art, ArtOlc, ArtPostingList, ArtReference, BTreeGoogleAbseil, BTreeGoogleAbseilMultimap,
+                  BTreeTlx, BTreeTlxMultimap, BTreeTlxPartitioned, BwTreeIndex, ColumnarSortedVector, Cssl,
+                  EytzingerArray, HashMapRobinHoodFlat, HashMapRobinHoodNode, HashMapRobinHoodPostingList,
+                  HashMapTslRobin, HashMapTslSparse, ShardedRobinHoodFlatMap, ShardedTslRobinMap, Judy, Masstree,
+                  PiecewiseLinearIndex, SimdSortedVector, SimpleVector, SkipList, SortedVector, UnorderedMap>(
+         cases, data, equality_lookups, range_lookups, workload_mixes, bulk_erase_fraction, filter),
+     ...);
+  }
+
+  template <template <typename, typename, typename> class Case, template <typename, typename> class... Indexes>
+  static void _add_indexes(std::vector<std::shared_ptr<BaseBenchmarkCase>>& cases, const Data<Key, Value>& data,
+                           const std::vector<EqualityLookup<Key>>& equality_lookups,
+                           const std::vector<RangeLookup<Key>>& range_lookups,
+                           const std::vector<WorkloadMix>& workload_mixes, const double bulk_erase_fraction,
+                           const CaseFilter& filter) {
+    (_add_case<Case, Indexes<Key, Value>>(cases, data, equality_lookups, range_lookups, workload_mixes,
+                                          bulk_erase_fraction, filter),
+     ...);
+  }
+
+  template <template <typename, typename, typename> class Case, typename Index>
+  static void _add_case(std::vector<std::shared_ptr<BaseBenchmarkCase>>& cases, const Data<Key, Value>& data,
+                        const std::vector<EqualityLookup<Key>>& equality_lookups,
+                        const std::vector<RangeLookup<Key>>& range_lookups,
+                        const std::vector<WorkloadMix>& workload_mixes, const double bulk_erase_fraction,
+                        const CaseFilter& filter) {
+    // the Judy Array can only be used when both keys and values are of type uint64_t
+    if constexpr (std::is_same_v<Index, Judy<Key, Value>> &&
+                  !(std::is_same_v<Key, uint64_t> && std::is_same_v<Value, uint64_t>)) {
+      return;
+    } else if constexpr (std::is_same_v<Key, std::string_view> && !_supports_string_keys<Index>()) {
+      return;
+    } else if constexpr (requires { typename Case<Index, Key, Value>; }) {  // the case's constraints are satisfied
+      using BenchmarkCase = Case<Index, Key, Value>;
+      if constexpr (std::is_constructible_v<BenchmarkCase, const Data<Key, Value>&,
+                                            const std::vector<EqualityLookup<Key>>&,
+                                            const std::vector<RangeLookup<Key>>&, const WorkloadMix&>) {
+        for (const auto& workload_mix : workload_mixes) {
+          _add_if_supported(cases, std::make_shared<BenchmarkCase>(data, equality_lookups, range_lookups, workload_mix),
+                            filter);
+        }
+      } else if constexpr (std::is_constructible_v<BenchmarkCase, const Data<Key, Value>&, double>) {
+        _add_if_supported(cases, std::make_shared<BenchmarkCase>(data, bulk_erase_fraction), filter);
+      } else if constexpr (std::is_constructible_v<BenchmarkCase, const Data<Key, Value>&,
+                                                   const std::vector<EqualityLookup<Key>>&>) {
+        _add_if_supported(cases, std::make_shared<BenchmarkCase>(data, equality_lookups), filter);
+      } else if constexpr (std::is_constructible_v<BenchmarkCase, const Data<Key, Value>&,
+                                                   const std::vector<RangeLookup<Key>>&>) {
+        _add_if_supported(cases, std::make_shared<BenchmarkCase>(data, range_lookups), filter);
+      } else {
+        _add_if_supported(cases, std::make_shared<BenchmarkCase>(data), filter);
+      }
+    }
+  }
+
+  template <typename Index>
+  static constexpr bool _supports_string_keys() {
+    return _is_one_of<Index, Art, ArtOlc, ArtPostingList, BTreeGoogleAbseil, BTreeGoogleAbseilMultimap, BTreeTlx,
+                      BTreeTlxMultimap, BTreeTlxPartitioned, HashMapRobinHoodFlat, HashMapRobinHoodNode,
+                      HashMapRobinHoodPostingList, HashMapTslRobin, HashMapTslSparse, SimpleVector, SortedVector,
+                      UnorderedMap>();
+  }
+
+  // the competitor types are only named, not instantiated
+  template <typename Index, template <typename, typename> class... Competitors>
+  static constexpr bool _is_one_of() {
+    return (std::is_same_v<Index, Competitors<Key, Value>> || ...);
+  }
+
+  static void _add_if_supported(std::vector<std::shared_ptr<BaseBenchmarkCase>>& cases,
+                                std::shared_ptr<BaseBenchmarkCase> benchmark_case, const CaseFilter& filter) {
+    if ((!filter || filter(*benchmark_case)) && benchmark_case->supported_by_index()) {
+      cases.push_back(std::move(benchmark_case));
+    }
+  }
+};
+
+}  // namespace imib
@@ -1,8 +1,19 @@
 #include "benchmark_runner.hpp"
 
+#include <algorithm>
 #include <cassert>
 #include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
 
+#include "benchmark_registry.hpp"
+#include "data/column.hpp"
+#include "data/data_generator.hpp"
+#include "data/mapped_string_file.hpp"
+#include "data/random_key_generator.hpp"
 #include "evaluation/report.hpp"
 #include "evaluation/report_exporter.hpp"
 #include "evaluation/timer.hpp"
@@ -10,35 +21,50 @@
 
 namespace imib {
 
-BenchmarkRunner::BenchmarkRunner(const std::vector<std::shared_ptr<BaseBenchmarkCase>>& cases,
-                                 const BenchmarkConfiguration config)
-    : _cases(cases), _config(std::move(config)), _report(Report()) {
-  assert(_config.threads == 1);  // Multi-threaded execution not supported yet.
+namespace {
+
+// the values are the positions of the keys in the data, i.e., tuple ids
+using Value = uint64_t;
+
+// adds the names of the indexes for which a case is registered to the names of the case
+template <typename Key>
+void add_registered_names(std::unordered_map<std::string, std::unordered_set<std::string>>& index_names_by_case,
+                          const BenchmarkConfiguration& config) {
+  const auto data = Data<Key, Value>{};
+  const auto equality_lookups = std::vector<EqualityLookup<Key>>{};
+  const auto range_lookups = std::vector<RangeLookup<Key>>{};
+  const auto cases = BenchmarkRegistry<Key, Value>::create_cases(data, equality_lookups, range_lookups,
+                                                                 config.workload_mixes, config.bulk_erase_fraction);
+  for (const auto& bench_case : cases) {
+    index_names_by_case[bench_case->name()].insert(bench_case->index_name());
+  }
+}
+
+// returns the data file, or the distribution of the generated keys including its seed
+std::string dataset_name(const DatasetConfiguration& dataset) {
+  return dataset.data_file.empty() ? RandomKeyGenerator::describe(dataset.key_distribution) : dataset.data_file;
+}
+
+}  // namespace
+
+BenchmarkRunner::BenchmarkRunner(const BenchmarkConfiguration config) : _config(std::move(config)), _report(Report()) {
+  assert(_config.threads > 0);
 }
 
 void BenchmarkRunner::run() {
-  auto print_info = [](const auto bench_case) {
-    std::cout << "Run " << bench_case->name() << ", " << bench_case->index_name()
-              << ", key type: " << bench_case->key_type() << ", value type: " << bench_case->value_type() << std::endl;
-  };
+  _validate_configuration();
 
-  std::vector<BenchmarkCaseStatistics> case_statistics(_cases.size());
-  auto case_index = size_t{0};
-  for (const auto& bench_case : _cases) {
-    print_info(bench_case);
-    std::vector<ExecutionStatistics> execution_statistics(_config.iterations);
-    for (auto execution_index = 0u; execution_index < _config.iterations; ++execution_index) {
-      std::cout << "iteration " << execution_index + 1 << std::endl;
-      Timer timer{};
-      _clear_cache();
-      const auto current_execution_stats = bench_case->execute();
-      execution_statistics[execution_index] = std::move(current_execution_stats);
-      // TODO(Marcel) execute in parallel
+  std::vector<BenchmarkCaseStatistics> case_statistics;
+  for (const auto& key_type : _config.key_types) {
+    for (const auto& dataset : _config.datasets) {
+      if (key_type == "uint32_t") {
+        _run_dataset<uint32_t>(dataset, case_statistics);
+      } else if (key_type == "uint64_t") {
+        _run_dataset<uint64_t>(dataset, case_statistics);
+      } else {
+        _run_dataset<std::string_view>(dataset, case_statistics);
+      }
     }
-    case_statistics[case_index] =
-        BenchmarkCaseStatistics{bench_case->name(),       bench_case->index_name(), bench_case->key_type(),
-                                bench_case->value_type(), bench_case->data_size(),  std::move(execution_statistics)};
-    ++case_index;
   }
   _report.benchmark_configuration = _config;
   _report.case_statistics = std::move(case_statistics);
@@ -57,6 +83,133 @@ void BenchmarkRunner::export_result(const std::string& output_file_path) const {
 
 void BenchmarkRunner::print_result() const { std::cout << _report << std::endl; }
 
+void BenchmarkRunner::_validate_configuration() const {
+  for (const auto& key_type : _config.key_types) {
+    if (key_type != "uint32_t" && key_type != "uint64_t" && key_type != Type<std::string_view>::name()) {
+      throw std::logic_error("Key type '" + key_type + "' is not supported.");
+    }
+  }
+
+  // some indexes are only registered for some key types, e.g., the Judy Array
+  auto index_names_by_case = std::unordered_map<std::string, std::unordered_set<std::string>>{};
+  add_registered_names<uint32_t>(index_names_by_case, _config);
+  add_registered_names<uint64_t>(index_names_by_case, _config);
+  add_registered_names<std::string_view>(index_names_by_case, _config);
+  auto all_index_names = std::unordered_set<std::string>{};
+  for (const auto& [case_name, index_names] : index_names_by_case) {
+    all_index_names.insert(index_names.cbegin(), index_names.cend());
+  }
+
+  for (const auto& selection : _config.cases) {
+    const auto case_iter = index_names_by_case.find(selection.case_name);
+    if (case_iter == index_names_by_case.cend()) {
+      throw std::logic_error("Unknown benchmark case '" + selection.case_name + "'.");
+    }
+    for (const auto& index_name : selection.index_names) {
+      if (!all_index_names.contains(index_name)) {
+        throw std::logic_error("Unknown index '" + index_name + "'.");
+      }
+      if (!case_iter->second.contains(index_name)) {
+        throw std::logic_error("The index '" + index_name + "' does not support the benchmark case '" +
+                               selection.case_name + "'.");
+      }
+    }
+  }
+}
+
+template <typename Key>
+void BenchmarkRunner::_run_dataset(const DatasetConfiguration& dataset,
+                                   std::vector<BenchmarkCaseStatistics>& case_statistics) const {
+  const auto data_name = dataset_name(dataset);
+  std::cout << "Generate data: " << data_name << ", key type: " << Type<Key>::name() << std::endl;
+  const auto mapping_options = MappingOptions{dataset.populate, dataset.huge_pages};
+  const auto data = dataset.data_file.empty()
+                        ? DataGenerator::generate<Key, Value>(dataset.key_distribution)
+                        : DataGenerator::generate<Key, Value>(dataset.data_file, mapping_options);
+  // string lookups point into their files, thus, the lookup files stay mapped until the cases are executed
+  const auto equality_lookup_file =
+      dataset.equality_lookup_file.empty()
+          ? nullptr
+          : std::make_shared<const MappedKeyFile<Key>>(dataset.equality_lookup_file, mapping_options);
+  const auto range_lookup_file =
+      dataset.range_lookup_file.empty()
+          ? nullptr
+          : std::make_shared<const MappedKeyFile<Key>>(dataset.range_lookup_file, mapping_options);
+  const auto equality_lookups =
+      equality_lookup_file
+          ? LookupGenerator::generate_equality_lookups<Key>(equality_lookup_file->values())
+          : LookupGenerator::generate_equality_lookups<Key>(data.keys(), dataset.equality_lookup_distribution);
+  const auto range_lookups = range_lookup_file
+                                 ? LookupGenerator::generate_range_lookups<Key>(range_lookup_file->values())
+                                 : LookupGenerator::generate_range_lookups<Key>(
+                                       data.keys(), dataset.range_lookup_distribution, dataset.range_lookup_size);
+
+  // only the selected cases are created, thus, the data only materializes what they use
+  const auto cases = _select_cases(BenchmarkRegistry<Key, Value>::create_cases(
+      data, equality_lookups, range_lookups, _config.workload_mixes, _config.bulk_erase_fraction,
+      [&](const BaseBenchmarkCase& bench_case) { return _is_selected(bench_case); }));
+
+  // The ARTs internally read the key of a TID from a column. Thus, the column is only filled if an ART is executed,
+  // otherwise the column of a previous dataset is released.
+  const auto reads_column = [](const auto& bench_case) {
+    const auto index_type = bench_case->index_type();
+    return index_type == IndexType::ART || index_type == IndexType::ARTOLC ||
+           index_type == IndexType::ARTPostingList || index_type == IndexType::ARTReference;
+  };
+  if (std::any_of(cases.cbegin(), cases.cend(), reads_column)) {
+    Column<Key, Value>::fill(data.entries());
+  } else {
+    Column<Key, Value>::values = nullptr;
+  }
+  for (const auto& bench_case : cases) {
+    if (_config.threads > 1 && !bench_case->supports_concurrent_execution()) {
+      std::cout << "Skip " << bench_case->name() << ", " << bench_case->index_name()
+                << ": concurrent execution with " << _config.threads << " threads is not supported." << std::endl;
+      continue;
+    }
+    std::cout << "Run " << bench_case->name() << ", " << bench_case->index_name()
+              << ", key type: " << bench_case->key_type() << ", value type: " << bench_case->value_type() << std::endl;
+    std::vector<ExecutionStatistics> execution_statistics(_config.iterations);
+    for (auto execution_index = 0u; execution_index < _config.iterations; ++execution_index) {
+      std::cout << "iteration " << execution_index + 1 << std::endl;
+      _clear_cache();
+      // in case of multiple threads, the execution statistics contain one measurement per thread
+      auto current_execution_stats = bench_case->execute(_config.threads, _config.record_latencies, _config.time_bound);
+      execution_statistics[execution_index] = std::move(current_execution_stats);
+    }
+    case_statistics.emplace_back(BenchmarkCaseStatistics{
+        bench_case->name(), bench_case->index_name(), bench_case->key_type(), bench_case->value_type(),
+        bench_case->data_size(), data_name, std::move(execution_statistics)});
+  }
+}
+
+std::vector<std::shared_ptr<BaseBenchmarkCase>> BenchmarkRunner::_select_cases(
+    const std::vector<std::shared_ptr<BaseBenchmarkCase>>& cases) const {
+  auto selected_cases = std::vector<std::shared_ptr<BaseBenchmarkCase>>{};
+  for (const auto& selection : _config.cases) {
+    for (const auto& bench_case : cases) {
+      if (!_selects(selection, *bench_case) ||
+          std::find(selected_cases.cbegin(), selected_cases.cend(), bench_case) != selected_cases.cend()) {
+        continue;
+      }
+      selected_cases.push_back(bench_case);
+    }
+  }
+  return selected_cases;
+}
+
+bool BenchmarkRunner::_is_selected(const BaseBenchmarkCase& bench_case) const {
+  return std::any_of(_config.cases.cbegin(), _config.cases.cend(),
+                     [&](const auto& selection) { return _selects(selection, bench_case); });
+}
+
+bool BenchmarkRunner::_selects(const CaseSelection& selection, const BaseBenchmarkCase& bench_case) {
+  const auto& index_names = selection.index_names;
+  return bench_case.name() == selection.case_name &&
+         (index_names.empty() ||
+          std::find(index_names.cbegin(), index_names.cend(), bench_case.index_name()) != index_names.cend());
+}
+
 void BenchmarkRunner::_clear_cache() const {
   std::vector<uint8_t> data = std::vector<uint8_t>();
   const auto larger_than_cache = 200 * 1024 * 1024;  // 200 MiB
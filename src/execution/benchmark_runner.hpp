@@ -4,26 +4,40 @@
 #include <cstdint>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "cases/base_benchmark_case.hpp"
 #include "evaluation/report.hpp"
 
 namespace imib {
 
-class BenchmarkCase;
-
+// Executes the cases that the configuration selects for each key type and dataset. The data and the lookups of a
+// dataset are generated before its cases are executed and released afterwards.
 class BenchmarkRunner {
  public:
-  BenchmarkRunner(const std::vector<std::shared_ptr<BaseBenchmarkCase>>& benchmark_cases,
-                  const BenchmarkConfiguration config);
+  explicit BenchmarkRunner(const BenchmarkConfiguration config);
   void run();
   void export_result(const std::string& output_file_path) const;
   void print_result() const;
 
  protected:
+  // throws if the configuration contains an unsupported key type or an unknown case or index name
+  void _validate_configuration() const;
+
+  template <typename Key>
+  void _run_dataset(const DatasetConfiguration& dataset, std::vector<BenchmarkCaseStatistics>& case_statistics) const;
+
+  // returns the cases in the order of the case selections, each case is returned once
+  std::vector<std::shared_ptr<BaseBenchmarkCase>> _select_cases(
+      const std::vector<std::shared_ptr<BaseBenchmarkCase>>& cases) const;
+
+  // returns whether any case selection selects the case
+  bool _is_selected(const BaseBenchmarkCase& bench_case) const;
+
+  static bool _selects(const CaseSelection& selection, const BaseBenchmarkCase& bench_case);
+
   void _clear_cache() const;
 
-  const std::vector<std::shared_ptr<BaseBenchmarkCase>>& _cases;
   const BenchmarkConfiguration _config;
 
   Report _report;
@@ -1,7 +1,9 @@
 #pragma once
 
+#include <chrono>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "base_benchmark_case.hpp"
 #include "types.hpp"
@@ -20,6 +22,9 @@ class AbstractBenchmarkCase : public BaseBenchmarkCase {
   // returns the name of the used index
   const std::string index_name() const override { return Index::name(); }
 
+  // returns the type of the used index
+  IndexType index_type() const override { return Index::type(); }
+
   // returns the key type as string
   const std::string key_type() const override { return Type<Key>::name(); }
 
@@ -27,9 +32,59 @@ class AbstractBenchmarkCase : public BaseBenchmarkCase {
   const std::string value_type() const override { return Type<Value>::name(); }
 
   // return the size of the data
-  size_t data_size() const override { return _data.entries.size(); }
+  size_t data_size() const override { return _data.entries().size(); }
+
+  // the indexes that only store unique keys do not support data with key duplicates
+  bool supported_by_index() const override { return Index::supports(operation_type()) && _supports_data(); }
+
+  // the competitors state for each operation whether it can be executed by multiple threads on the same index
+  bool supports_concurrent_execution() const override { return Index::supports_concurrent(operation_type()); }
 
  protected:
+  bool _supports_data() const { return Index::supports_key_duplicates() || _data.unique_keys(); }
+
+  // Fills an empty index with the data. Read-optimized indexes are built with a single bulk operation, since their
+  // single inserts are not meant to build the whole index.
+  void _fill(Index& index) const { _fill(index, _data); }
+
+  // fills an empty index with the given data, e.g., a part of the data
+  static void _fill(Index& index, const Data<Key, Value>& data) {
+    if (Index::type() == IndexType::SortedVector || Index::type() == IndexType::ColumnarSortedVector ||
+        Index::type() == IndexType::SimdSortedVector) {
+      index.bulk_insert(data);
+    } else if (Index::type() == IndexType::CSSL || Index::type() == IndexType::EytzingerArray ||
+               Index::type() == IndexType::PiecewiseLinearIndex) {
+      index.bulk_load(data);
+    } else {
+      for (const auto& entry : data.entries()) {
+        index.insert(entry.first, entry.second);
+      }
+    }
+  }
+
+  // Lets the indexes that defer freeing memory, e.g., Masstree with its epoch-based reclamation, free the memory of the
+  // erased entries after a measured phase. Called by the thread that drives the benchmark while no operation runs.
+  static void _reclaim(Index& index) {
+    if constexpr (requires { index.reclaim(); }) {
+      index.reclaim();
+    }
+  }
+
+  // creates the execution statistics of a (multi-threaded) execution with one measurement per thread
+  static ExecutionStatistics _execution_statistics(const std::vector<Measurements>& measurements,
+                                                   const uint64_t index_size_bytes,
+                                                   const LatencyHistogram& latencies = LatencyHistogram{},
+                                                   const ThroughputSeries& throughput_series = ThroughputSeries{}) {
+    auto statistics = ExecutionStatistics{};
+    statistics.latencies = latencies;
+    statistics.throughput_series = throughput_series;
+    statistics.measurements = measurements;
+    for (auto& measurement : statistics.measurements) {
+      measurement.index_size_bytes = index_size_bytes;
+    }
+    return statistics;
+  }
+
   const Data<Key, Value>& _data;
 };
 
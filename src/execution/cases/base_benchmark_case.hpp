@@ -1,6 +1,7 @@
 #pragma once
 
 #include "evaluation/report.hpp"
+#include "types.hpp"
 
 namespace imib {
 
@@ -11,15 +12,33 @@ class BaseBenchmarkCase {
   virtual ~BaseBenchmarkCase() = default;
   const BaseBenchmarkCase& operator=(const BaseBenchmarkCase&) = delete;
 
-  // executes the benchmark scenario and returns the duration in nanoseconds
-  virtual const ExecutionStatistics execute() const = 0;
+  // executes the benchmark scenario with the given number of threads and returns the duration in nanoseconds. In
+  // case of multiple threads, the statistics contain one measurement per thread. If record_latencies is true, the
+  // statistics also contain the latencies of the single index operations. The bulk operations are a single index
+  // operation, thus, their latency is their duration. If the time bound is enabled, the operations are executed for
+  // its duration (see ParallelExecutor) and the statistics contain the throughput series. The bulk operations ignore
+  // the time bound.
+  virtual const ExecutionStatistics execute(const size_t thread_count, const bool record_latencies,
+                                            const TimeBound& time_bound) const = 0;
+
+  // returns whether the used index supports the index operations of the benchmark scenario
+  virtual bool supported_by_index() const = 0;
+
+  // returns whether the benchmark scenario can be executed by multiple threads at the same time
+  virtual bool supports_concurrent_execution() const = 0;
 
   // returns the name of the benchmark case
   virtual const std::string name() const = 0;
 
+  // returns the index operation that is benchmarked
+  virtual IndexOperationType operation_type() const = 0;
+
   // returns the name of the used index
   virtual const std::string index_name() const = 0;
 
+  // returns the type of the used index
+  virtual IndexType index_type() const = 0;
+
   // returns the key type as string
   virtual const std::string key_type() const = 0;
 
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <algorithm>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include "abstract_benchmark_case.hpp"
+#include "evaluation/memory_tracker.hpp"
+#include "evaluation/timer.hpp"
+#include "execution/parallel_executor.hpp"
+#include "types.hpp"
+
+namespace imib {
+
+// Executes the equality lookups in batches of BATCH_SIZE keys with the index's equality_lookup_batch, like a join or an
+// IN-list probes an index. Each thread reuses one result buffer for all of its batches.
+template <typename Index, typename Key, typename Value>
+  requires requires(const Index& index, std::span<const Key> keys, std::vector<Value>& result) {
+    index.equality_lookup_batch(keys, result);
+  }
+class CaseBatchedEqualityLookup final : public AbstractBenchmarkCase<Index, Key, Value> {
+ public:
+  explicit CaseBatchedEqualityLookup(const Data<Key, Value>& data,
+                                     const std::vector<EqualityLookup<Key>>& equality_lookups)
+      : AbstractBenchmarkCase<Index, Key, Value>(data) {
+    // the batch lookup requires the keys to be stored consecutively
+    _keys.reserve(equality_lookups.size());
+    for (const auto& equality_lookup : equality_lookups) {
+      _keys.push_back(equality_lookup.key);
+    }
+  }
+
+  const std::string name() const override { return "BatchedEqualityLookup"; }
+
+  IndexOperationType operation_type() const override { return IndexOperationType::EqualityLookup; }
+
+  // only time is tracked, memory is set to 0
+  const ExecutionStatistics execute(const size_t thread_count, const bool record_latencies,
+                                    const TimeBound& time_bound) const override {
+    // preparation: fill index
+    auto index = std::make_shared<Index>();
+    this->_fill(*index);
+
+    // benchmark scenario: execute x equality lookups in batches, each thread executes a partition of the lookups
+    const auto keys = std::span<const Key>{_keys};
+    // the latency of a batch is recorded, since the lookups of a batch are interleaved
+    auto latencies = LatencyHistogram{};
+    auto throughput_series = ThroughputSeries{};
+    const auto measurements = ParallelExecutor::execute(
+        thread_count, _keys.size(), record_latencies, time_bound, true, latencies, throughput_series,
+        [&](const size_t begin, const size_t end, LatencyRecorder& recorder) {
+          auto result = std::vector<Value>{};
+          for (auto batch_begin = begin; batch_begin < end; batch_begin += BATCH_SIZE) {
+            const auto start_ticks = recorder.start();
+            result.clear();
+            index->equality_lookup_batch(keys.subspan(batch_begin, std::min(BATCH_SIZE, end - batch_begin)), result);
+            recorder.stop(start_ticks);
+          }
+        },
+        BATCH_SIZE);
+    return this->_execution_statistics(measurements, 0, latencies, throughput_series);
+  }
+
+ private:
+  static constexpr size_t BATCH_SIZE = 1024;
+
+  std::vector<Key> _keys;
+};
+
+}  // namespace imib
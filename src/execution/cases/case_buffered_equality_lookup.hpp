@@ -0,0 +1,58 @@
+#pragma once
+
+#include <stdexcept>
+#include <type_traits>
+
+#include "abstract_benchmark_case.hpp"
+#include "evaluation/memory_tracker.hpp"
+#include "evaluation/timer.hpp"
+#include "execution/parallel_executor.hpp"
+#include "types.hpp"
+
+namespace imib {
+
+// Executes the equality lookups like the CaseEqualityLookup, but with the lookup overload that appends the values to a
+// result buffer. Each thread reuses one buffer for all of its lookups, thus, the measured time does not include the
+// allocation of a result vector per lookup.
+template <typename Index, typename Key, typename Value>
+class CaseBufferedEqualityLookup final : public AbstractBenchmarkCase<Index, Key, Value> {
+ public:
+  explicit CaseBufferedEqualityLookup(const Data<Key, Value>& data,
+                                      const std::vector<EqualityLookup<Key>>& equality_lookups)
+      : AbstractBenchmarkCase<Index, Key, Value>(data), _equality_lookups(equality_lookups) {
+    // do nothing;
+  }
+
+  const std::string name() const override { return "BufferedEqualityLookup"; }
+
+  IndexOperationType operation_type() const override { return IndexOperationType::EqualityLookup; }
+
+  // only time is tracked, memory is set to 0
+  const ExecutionStatistics execute(const size_t thread_count, const bool record_latencies,
+                                    const TimeBound& time_bound) const override {
+    // preparation: fill index
+    auto index = std::make_shared<Index>();
+    this->_fill(*index);
+
+    // benchmark scenario: execute x equality lookups, each thread executes a partition of the lookups
+    auto latencies = LatencyHistogram{};
+    auto throughput_series = ThroughputSeries{};
+    const auto measurements = ParallelExecutor::execute(
+        thread_count, _equality_lookups.size(), record_latencies, time_bound, true, latencies, throughput_series,
+        [&](const size_t begin, const size_t end, LatencyRecorder& recorder) {
+          auto result = std::vector<Value>{};
+          for (auto lookup_index = begin; lookup_index < end; ++lookup_index) {
+            const auto start_ticks = recorder.start();
+            result.clear();
+            index->equality_lookup(_equality_lookups[lookup_index].key, result);
+            recorder.stop(start_ticks);
+          }
+        });
+    return this->_execution_statistics(measurements, 0, latencies, throughput_series);
+  }
+
+ private:
+  const std::vector<EqualityLookup<Key>>& _equality_lookups;
+};
+
+}  // namespace imib
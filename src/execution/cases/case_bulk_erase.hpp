@@ -0,0 +1,62 @@
+#pragma once
+
+#include <algorithm>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include "abstract_benchmark_case.hpp"
+#include "evaluation/memory_tracker.hpp"
+#include "execution/parallel_executor.hpp"
+#include "types.hpp"
+
+namespace imib {
+
+// Erases a fraction of the entries from a filled index with one bulk erase, like the drop of a partition or the
+// expiry of the oldest entries. The erased entries are the ones with the smallest keys, thus, they form one key range.
+// Next to the size of the index after the erase, the statistics contain the memory that the index returned to the
+// allocator, e.g., the hash maps keep their buckets while the trees free their nodes.
+template <typename Index, typename Key, typename Value>
+class CaseBulkErase final : public AbstractBenchmarkCase<Index, Key, Value> {
+ public:
+  CaseBulkErase(const Data<Key, Value>& data, const double erase_fraction)
+      : AbstractBenchmarkCase<Index, Key, Value>(data), _erase_fraction(erase_fraction) {
+    if (_erase_fraction <= 0.0 || _erase_fraction > 1.0) {
+      throw std::logic_error("The fraction of the entries to bulk erase has to be in (0, 1].");
+    }
+  }
+
+  const std::string name() const override { return "BulkErase"; }
+
+  IndexOperationType operation_type() const override { return IndexOperationType::BulkErase; }
+
+  // the bulk operation is a single index operation, thus, it is executed by one thread
+  const ExecutionStatistics execute(const size_t thread_count, const bool record_latencies,
+                                    const TimeBound& time_bound) const override {
+    // preparation: select the entries to erase and fill the index
+    auto erased_entries = this->_data.entries();
+    std::sort(erased_entries.begin(), erased_entries.end());
+    erased_entries.resize(static_cast<size_t>(_erase_fraction * static_cast<double>(erased_entries.size())));
+    const auto erase_count = erased_entries.size();
+    const auto erased_data = Data<Key, Value>{{}, {}, std::move(erased_entries), {}};
+
+    const auto memory_before = MemoryTracker::allocated_bytes();
+    auto index = std::make_shared<Index>();
+    this->_fill(*index);
+
+    // benchmark scenario
+    const auto memory_before_erase = MemoryTracker::allocated_bytes();
+    const auto measurement = ParallelExecutor::measure(erase_count, [&]() { index->bulk_erase(erased_data); });
+    this->_reclaim(*index);
+    const auto memory_after = MemoryTracker::allocated_bytes();
+    auto statistics = this->_execution_statistics({measurement}, memory_after - memory_before);
+    statistics.freed_bytes = memory_before_erase > memory_after ? memory_before_erase - memory_after : 0;
+    return statistics;
+  }
+
+ private:
+  const double _erase_fraction;
+};
+
+}  // namespace imib
@@ -5,7 +5,7 @@
 #include "abstract_benchmark_case.hpp"
 #include "competitors/simple_vector.hpp"
 #include "evaluation/memory_tracker.hpp"
-#include "evaluation/timer.hpp"
+#include "execution/parallel_executor.hpp"
 #include "types.hpp"
 
 namespace imib {
@@ -19,16 +19,19 @@ class CaseBulkInsert final : public AbstractBenchmarkCase<Index, Key, Value> {
 
   const std::string name() const override { return "BulkInsert"; }
 
-  const ExecutionStatistics execute() const override {
+  IndexOperationType operation_type() const override { return IndexOperationType::BulkInsert; }
+
+  // the bulk operation is a single index operation, thus, it is executed by one thread
+  const ExecutionStatistics execute(const size_t thread_count, const bool record_latencies,
+                                    const TimeBound& time_bound) const override {
     // benchmark scenario
+    const auto entry_count = this->_data.keys().size();
     const auto memory_before = MemoryTracker::allocated_bytes();
     auto index = std::make_shared<Index>();
 
-    Timer timer{};
-    index->bulk_insert(this->_data);
-    const auto duration = timer.lap();
+    const auto measurement = ParallelExecutor::measure(entry_count, [&]() { index->bulk_insert(this->_data); });
     const auto memory_after = MemoryTracker::allocated_bytes();
-    return {{{duration, memory_after - memory_before}}};
+    return this->_execution_statistics({measurement}, memory_after - memory_before);
   }
 };
 
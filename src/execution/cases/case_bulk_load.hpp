@@ -5,8 +5,9 @@
 #include "abstract_benchmark_case.hpp"
 #include "competitors/simple_vector.hpp"
 #include "evaluation/memory_tracker.hpp"
-#include "evaluation/timer.hpp"
+#include "execution/parallel_executor.hpp"
 #include "types.hpp"
+#include "utils/parallel_sort.hpp"
 
 namespace imib {
 
@@ -19,26 +20,30 @@ class CaseBulkLoad final : public AbstractBenchmarkCase<Index, Key, Value> {
 
   const std::string name() const override { return "BulkLoad"; }
 
-  const ExecutionStatistics execute() const override {
+  IndexOperationType operation_type() const override { return IndexOperationType::BulkLoad; }
+
+  // the bulk operation is a single index operation, thus, it is executed by one thread
+  const ExecutionStatistics execute(const size_t thread_count, const bool record_latencies,
+                                    const TimeBound& time_bound) const override {
     // benchmark scenario
+    const auto entry_count = this->_data.keys().size();
     const auto memory_before = MemoryTracker::allocated_bytes();
     auto index = std::make_shared<Index>();
 
-    if (Index::type() == IndexType::BTreeTLX) {
-      // the bulk load operation of the BTreeTLX requires sorted entries
-      auto entries = this->_data.entries;
-      Timer timer{};
-      std::sort(entries.begin(), entries.end());
-      index->bulk_load(Data<Key, Value>{{}, {}, std::move(entries), {}});
-      const auto duration = timer.lap();
+    if (Index::type() == IndexType::BTreeTLX || Index::type() == IndexType::BTreeTLXMultimap ||
+        Index::type() == IndexType::BTreeTLXPartitioned) {
+      // the bulk load operation of the BTreeTLX requires sorted entries, they are sorted with all cores
+      auto entries = this->_data.entries();
+      const auto measurement = ParallelExecutor::measure(entry_count, [&]() {
+        ParallelSort::sort(entries);
+        index->bulk_load(Data<Key, Value>{{}, {}, std::move(entries), {}});
+      });
       const auto memory_after = MemoryTracker::allocated_bytes();
-      return {{{duration, memory_after - memory_before}}};
+      return this->_execution_statistics({measurement}, memory_after - memory_before);
     } else {
-      Timer timer{};
-      index->bulk_load(this->_data);
-      const auto duration = timer.lap();
+      const auto measurement = ParallelExecutor::measure(entry_count, [&]() { index->bulk_load(this->_data); });
       const auto memory_after = MemoryTracker::allocated_bytes();
-      return {{{duration, memory_after - memory_before}}};
+      return this->_execution_statistics({measurement}, memory_after - memory_before);
     }
   }
 };
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <vector>
+
+#include "abstract_benchmark_case.hpp"
+#include "evaluation/memory_tracker.hpp"
+#include "execution/parallel_executor.hpp"
+#include "types.hpp"
+
+namespace imib {
+
+// Executes the equality lookups on the indexes that store key duplicates, e.g., a non-unique secondary index on a
+// column with few distinct values. Each lookup returns all values of its key, which the statistics count, thus, the
+// lookup time per returned value and the index size per entry can be compared across the posting list layouts.
+template <typename Index, typename Key, typename Value>
+class CaseDuplicateEqualityLookup final : public AbstractBenchmarkCase<Index, Key, Value> {
+ public:
+  explicit CaseDuplicateEqualityLookup(const Data<Key, Value>& data,
+                                       const std::vector<EqualityLookup<Key>>& equality_lookups)
+      : AbstractBenchmarkCase<Index, Key, Value>(data), _equality_lookups(equality_lookups) {
+    // do nothing;
+  }
+
+  const std::string name() const override { return "DuplicateEqualityLookup"; }
+
+  IndexOperationType operation_type() const override { return IndexOperationType::EqualityLookup; }
+
+  bool supported_by_index() const override {
+    return Index::supports_key_duplicates() && AbstractBenchmarkCase<Index, Key, Value>::supported_by_index();
+  }
+
+  // the memory is the size of the filled index
+  const ExecutionStatistics execute(const size_t thread_count, const bool record_latencies,
+                                    const TimeBound& time_bound) const override {
+    // preparation: fill index
+    const auto memory_before = MemoryTracker::allocated_bytes();
+    auto index = std::make_shared<Index>();
+    this->_fill(*index);
+    const auto memory_after = MemoryTracker::allocated_bytes();
+
+    // benchmark scenario: execute x equality lookups, each thread executes a partition of the lookups
+    auto latencies = LatencyHistogram{};
+    auto throughput_series = ThroughputSeries{};
+    const auto measurements = ParallelExecutor::execute(
+        thread_count, _equality_lookups.size(), record_latencies, time_bound, true, latencies, throughput_series,
+        [&](const size_t begin, const size_t end, LatencyRecorder& recorder) {
+          auto result = std::vector<Value>{};
+          for (auto lookup_index = begin; lookup_index < end; ++lookup_index) {
+            const auto start_ticks = recorder.start();
+            result.clear();
+            index->equality_lookup(_equality_lookups[lookup_index].key, result);
+            recorder.stop(start_ticks);
+          }
+        });
+    auto statistics =
+        this->_execution_statistics(measurements, memory_after - memory_before, latencies, throughput_series);
+    // each lookup is counted once, also if a time-bounded execution repeated it
+    auto result = std::vector<Value>{};
+    for (const auto& equality_lookup : _equality_lookups) {
+      index->equality_lookup(equality_lookup.key, result);
+      statistics.result_count += result.size();
+      result.clear();
+    }
+    return statistics;
+  }
+
+ private:
+  const std::vector<EqualityLookup<Key>>& _equality_lookups;
+};
+
+}  // namespace imib
@@ -7,6 +7,7 @@
 #include "competitors/simple_vector.hpp"
 #include "evaluation/memory_tracker.hpp"
 #include "evaluation/timer.hpp"
+#include "execution/parallel_executor.hpp"
 #include "types.hpp"
 
 namespace imib {
@@ -21,26 +22,28 @@ class CaseEqualityLookup final : public AbstractBenchmarkCase<Index, Key, Value>
 
   const std::string name() const override { return "EqualityLookup"; }
 
+  IndexOperationType operation_type() const override { return IndexOperationType::EqualityLookup; }
+
   // only time is tracked, memory is set to 0
-  const ExecutionStatistics execute() const override {
+  const ExecutionStatistics execute(const size_t thread_count, const bool record_latencies,
+                                    const TimeBound& time_bound) const override {
     // preparation: fill index
     auto index = std::make_shared<Index>();
-
-    if (Index::type() == IndexType::SortedVector) {
-      index->bulk_insert(this->_data);
-    } else {
-      for (auto& entry : this->_data.entries) {
-        index->insert(entry.first, entry.second);
-      }
-    }
-
-    // benchmark scenario: execute x equality lookups
-    Timer timer{};
-    for (const auto& lookup : this->_equality_lookups) {
-      index->equality_lookup(lookup.key);
-    }
-    const auto duration = timer.lap();
-    return {{{duration, 0}}};
+    this->_fill(*index);
+
+    // benchmark scenario: execute x equality lookups, each thread executes a partition of the lookups
+    auto latencies = LatencyHistogram{};
+    auto throughput_series = ThroughputSeries{};
+    const auto measurements = ParallelExecutor::execute(
+        thread_count, _equality_lookups.size(), record_latencies, time_bound, true, latencies, throughput_series,
+        [&](const size_t begin, const size_t end, LatencyRecorder& recorder) {
+          for (auto lookup_index = begin; lookup_index < end; ++lookup_index) {
+            const auto start_ticks = recorder.start();
+            index->equality_lookup(_equality_lookups[lookup_index].key);
+            recorder.stop(start_ticks);
+          }
+        });
+    return this->_execution_statistics(measurements, 0, latencies, throughput_series);
   }
 
  private:
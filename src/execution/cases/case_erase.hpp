@@ -6,6 +6,7 @@
 #include "competitors/simple_vector.hpp"
 #include "evaluation/memory_tracker.hpp"
 #include "evaluation/timer.hpp"
+#include "execution/parallel_executor.hpp"
 #include "types.hpp"
 
 namespace imib {
@@ -19,22 +20,33 @@ class CaseErase final : public AbstractBenchmarkCase<Index, Key, Value> {
 
   const std::string name() const override { return "Erase"; }
 
+  IndexOperationType operation_type() const override { return IndexOperationType::EraseEntry; }
+
   // only time measurement
-  const ExecutionStatistics execute() const override {
+  const ExecutionStatistics execute(const size_t thread_count, const bool record_latencies,
+                                    const TimeBound& time_bound) const override {
     // preparation
     auto index = std::make_shared<Index>();
 
-    for (auto& entry : this->_data.entries) {
+    for (auto& entry : this->_data.entries()) {
       index->insert(entry.first, entry.second);
     }
 
-    // benchmark scenario
-    Timer timer{};
-    for (auto& entry : this->_data.entries) {
-      index->erase(entry.first, entry.second);
-    }
-    const auto duration = timer.lap();
-    return {{{duration, 0}}};
+    // benchmark scenario: each thread erases a partition of the entries from the shared index
+    const auto& entries = this->_data.entries();
+    auto latencies = LatencyHistogram{};
+    auto throughput_series = ThroughputSeries{};
+    const auto measurements = ParallelExecutor::execute(
+        thread_count, entries.size(), record_latencies, time_bound, false, latencies, throughput_series,
+        [&](const size_t begin, const size_t end, LatencyRecorder& recorder) {
+          for (auto entry_index = begin; entry_index < end; ++entry_index) {
+            const auto start_ticks = recorder.start();
+            index->erase(entries[entry_index].first, entries[entry_index].second);
+            recorder.stop(start_ticks);
+          }
+        });
+    this->_reclaim(*index);
+    return this->_execution_statistics(measurements, 0, latencies, throughput_series);
   }
 };
 
@@ -3,6 +3,7 @@
 #include "competitors/simple_vector.hpp"
 #include "evaluation/memory_tracker.hpp"
 #include "evaluation/timer.hpp"
+#include "execution/parallel_executor.hpp"
 #include "types.hpp"
 
 namespace imib {
@@ -16,18 +17,29 @@ class CaseInsert final : public AbstractBenchmarkCase<Index, Key, Value> {
 
   const std::string name() const override { return "Insert"; }
 
-  const ExecutionStatistics execute() const override {
-    // benchmark scenario
+  IndexOperationType operation_type() const override { return IndexOperationType::InsertEntry; }
+
+  const ExecutionStatistics execute(const size_t thread_count, const bool record_latencies,
+                                    const TimeBound& time_bound) const override {
+    // benchmark scenario: each thread inserts a partition of the entries into the shared index
     const auto memory_before = MemoryTracker::allocated_bytes();
     auto index = std::make_shared<Index>();
 
-    Timer timer{};
-    for (auto& entry : this->_data.entries) {
-      index->insert(entry.first, entry.second);
-    }
-    const auto duration = timer.lap();
+    const auto& entries = this->_data.entries();
+    auto latencies = LatencyHistogram{};
+    auto throughput_series = ThroughputSeries{};
+    const auto measurements = ParallelExecutor::execute(
+        thread_count, entries.size(), record_latencies, time_bound, false, latencies, throughput_series,
+        [&](const size_t begin, const size_t end, LatencyRecorder& recorder) {
+          for (auto entry_index = begin; entry_index < end; ++entry_index) {
+            const auto start_ticks = recorder.start();
+            index->insert(entries[entry_index].first, entries[entry_index].second);
+            recorder.stop(start_ticks);
+          }
+        });
+    this->_reclaim(*index);
     const auto memory_after = MemoryTracker::allocated_bytes();
-    return {{{duration, memory_after - memory_before}}};
+    return this->_execution_statistics(measurements, memory_after - memory_before, latencies, throughput_series);
   }
 };
 
@@ -0,0 +1,173 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "abstract_benchmark_case.hpp"
+#include "data/workload_generator.hpp"
+#include "evaluation/latency_recorder.hpp"
+#include "execution/parallel_executor.hpp"
+#include "types.hpp"
+
+namespace imib {
+
+// Executes a trace of equality lookups, range lookups, inserts, and updates with the shares of a workload mix (see
+// WorkloadGenerator) on an index that is filled with the initial entries of the trace, similar to the YCSB workloads.
+// The trace contains as many operations as equality lookups are given, and each thread executes a partition of the
+// trace. Concurrent updates of the same entry are not coordinated, i.e., an equality lookup may miss an entry that is
+// updated at the same time. The latencies are recorded per operation type. With a time bound, the trace is repeated
+// until the time is over if the mix does not insert, since repeated inserts would not insert new entries.
+template <typename Index, typename Key, typename Value>
+class CaseMixedWorkload final : public AbstractBenchmarkCase<Index, Key, Value> {
+ public:
+  explicit CaseMixedWorkload(const Data<Key, Value>& data, const std::vector<EqualityLookup<Key>>& equality_lookups,
+                             const std::vector<RangeLookup<Key>>& range_lookups, const WorkloadMix& workload_mix)
+      : AbstractBenchmarkCase<Index, Key, Value>(data),
+        _equality_lookups(equality_lookups),
+        _range_lookups(range_lookups),
+        _workload_mix(workload_mix) {
+    // do nothing;
+  }
+
+  const std::string name() const override { return "MixedWorkload(" + _workload_mix.name + ")"; }
+
+  // returns the index operation with the largest share of the mix
+  IndexOperationType operation_type() const override {
+    const auto& mix = _workload_mix;
+    if (mix.equality_lookups >= mix.range_lookups && mix.equality_lookups >= mix.inserts &&
+        mix.equality_lookups >= mix.updates) {
+      return IndexOperationType::EqualityLookup;
+    }
+    if (mix.range_lookups >= mix.inserts && mix.range_lookups >= mix.updates) {
+      return IndexOperationType::RangeLookup;
+    }
+    return mix.inserts >= mix.updates ? IndexOperationType::InsertEntry : IndexOperationType::EraseEntry;
+  }
+
+  bool supported_by_index() const override {
+    if (!this->_supports_data()) {
+      return false;
+    }
+    for (const auto operation_type : _operation_types()) {
+      if (!Index::supports(operation_type)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  bool supports_concurrent_execution() const override {
+    for (const auto operation_type : _operation_types()) {
+      if (!Index::supports_concurrent(operation_type)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  // only time is tracked, memory is set to 0
+  const ExecutionStatistics execute(const size_t thread_count, const bool record_latencies,
+                                    const TimeBound& time_bound) const override {
+    // preparation: generate the trace and fill the index with its initial entries
+    auto workload = WorkloadGenerator::generate<Key, Value>(_workload_mix, this->_data.entries(),
+                                                            _equality_lookups.size(), _equality_lookups.size(),
+                                                            _range_lookups.size());
+    const auto initial_data = Data<Key, Value>{{}, {}, std::move(workload.initial_entries), {}};
+    const auto& initial_entries = initial_data.entries();
+    const auto& insert_entries = workload.insert_entries;
+    const auto& operations = workload.operations;
+    auto index = std::make_shared<Index>();
+    this->_fill(*index, initial_data);
+
+    // benchmark scenario: each thread executes a partition of the trace
+    auto latencies = LatencyHistogram{};
+    auto operation_latencies = std::array<LatencyHistogram, WORKLOAD_OPERATION_TYPE_COUNT>{};
+    auto operation_latencies_mutex = std::mutex{};
+    auto throughput_series = ThroughputSeries{};
+    const auto measurements = ParallelExecutor::execute(
+        thread_count, operations.size(), record_latencies, time_bound, _workload_mix.inserts == 0, latencies,
+        throughput_series,
+        [&](const size_t begin, const size_t end, LatencyRecorder& thread_recorder) {
+          // the recorder of the thread is disabled during the warm-up of a time-bounded execution
+          const auto record = thread_recorder.enabled();
+          auto recorders = std::array<LatencyRecorder, WORKLOAD_OPERATION_TYPE_COUNT>{
+              LatencyRecorder{record}, LatencyRecorder{record}, LatencyRecorder{record}, LatencyRecorder{record}};
+          auto result = std::vector<Value>{};
+          for (auto operation_index = begin; operation_index < end; ++operation_index) {
+            const auto& operation = operations[operation_index];
+            auto& recorder = recorders[static_cast<size_t>(operation.type)];
+            const auto start_ticks = recorder.start();
+            switch (operation.type) {
+              case WorkloadOperationType::EqualityLookup:
+                result.clear();
+                index->equality_lookup(_equality_lookups[operation.position].key, result);
+                break;
+              case WorkloadOperationType::RangeLookup:
+                result.clear();
+                index->range_lookup(_range_lookups[operation.position].lower_bound_key,
+                                    _range_lookups[operation.position].upper_bound_key, result);
+                break;
+              case WorkloadOperationType::Insert:
+                index->insert(insert_entries[operation.position].first, insert_entries[operation.position].second);
+                break;
+              case WorkloadOperationType::Update:
+                index->erase(initial_entries[operation.position].first, initial_entries[operation.position].second);
+                index->insert(initial_entries[operation.position].first, initial_entries[operation.position].second);
+                break;
+            }
+            recorder.stop(start_ticks);
+          }
+          if (record) {
+            const auto lock = std::lock_guard<std::mutex>{operation_latencies_mutex};
+            for (size_t type = 0; type < WORKLOAD_OPERATION_TYPE_COUNT; ++type) {
+              operation_latencies[type].merge(recorders[type].histogram());
+            }
+          }
+        },
+        CHUNK_SIZE);
+    this->_reclaim(*index);
+
+    for (const auto& histogram : operation_latencies) {
+      latencies.merge(histogram);
+    }
+    auto statistics = this->_execution_statistics(measurements, 0, latencies, throughput_series);
+    for (size_t type = 0; type < WORKLOAD_OPERATION_TYPE_COUNT; ++type) {
+      if (operation_latencies[type].count() > 0) {
+        statistics.operation_latencies.emplace(
+            WorkloadGenerator::operation_name(static_cast<WorkloadOperationType>(type)), operation_latencies[type]);
+      }
+    }
+    return statistics;
+  }
+
+ private:
+  // the number of operations between two checks of a time bound, the latencies are merged after each chunk
+  static constexpr size_t CHUNK_SIZE = 1024;
+
+  // returns the index operations that the mix executes
+  std::vector<IndexOperationType> _operation_types() const {
+    auto operation_types = std::vector<IndexOperationType>{};
+    if (_workload_mix.equality_lookups > 0) {
+      operation_types.push_back(IndexOperationType::EqualityLookup);
+    }
+    if (_workload_mix.range_lookups > 0) {
+      operation_types.push_back(IndexOperationType::RangeLookup);
+    }
+    if (_workload_mix.inserts > 0 || _workload_mix.updates > 0) {
+      operation_types.push_back(IndexOperationType::InsertEntry);
+    }
+    if (_workload_mix.updates > 0) {
+      operation_types.push_back(IndexOperationType::EraseEntry);
+    }
+    return operation_types;
+  }
+
+  const std::vector<EqualityLookup<Key>>& _equality_lookups;
+  const std::vector<RangeLookup<Key>>& _range_lookups;
+  const WorkloadMix _workload_mix;
+};
+
+}  // namespace imib
@@ -0,0 +1,209 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <latch>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "evaluation/latency_histogram.hpp"
+#include "evaluation/latency_recorder.hpp"
+#include "evaluation/performance_counters.hpp"
+#include "evaluation/report.hpp"
+#include "evaluation/throughput_monitor.hpp"
+#include "evaluation/timer.hpp"
+#include "types.hpp"
+
+namespace imib {
+
+// Executes a workload of item_count items, e.g., lookups or entries to insert, with thread_count threads. The items
+// are partitioned into contiguous ranges of (almost) equal size. Each thread processes one range by calling
+// function(begin, end) and measures the time it took for its range. All threads start their timer at the same time
+// after they were spawned, i.e., the thread creation is not measured.
+class ParallelExecutor {
+ public:
+  ParallelExecutor() = delete;
+
+  // returns the duration of each thread, indexed by the thread id
+  template <typename Function>
+  static std::vector<std::chrono::nanoseconds> execute(const size_t thread_count, const size_t item_count,
+                                                       const Function& function) {
+    auto latencies = LatencyHistogram{};
+    const auto measurements =
+        execute(thread_count, item_count, false, latencies,
+                [&](const size_t begin, const size_t end, LatencyRecorder&) { function(begin, end); });
+    auto durations = std::vector<std::chrono::nanoseconds>{};
+    durations.reserve(measurements.size());
+    for (const auto& measurement : measurements) {
+      durations.push_back(measurement.duration);
+    }
+    return durations;
+  }
+
+  // Like execute above, but returns the measurements of each thread, including its hardware event counts, and each
+  // thread calls function(begin, end, recorder) with its own LatencyRecorder, which records the latencies of the
+  // single operations if record_latencies is true. The latencies of all threads are merged into the given histogram.
+  template <typename Function>
+  static std::vector<Measurements> execute(const size_t thread_count, const size_t item_count,
+                                           const bool record_latencies, LatencyHistogram& latencies,
+                                           const Function& function) {
+    auto recorders = std::vector<LatencyRecorder>{};
+    recorders.reserve(thread_count);
+    for (size_t thread_id = 0; thread_id < thread_count; ++thread_id) {
+      recorders.emplace_back(record_latencies);
+    }
+
+    auto measurements = std::vector<Measurements>(thread_count);
+    _run(thread_count, item_count, [&](const size_t thread_id, const std::pair<size_t, size_t> range) {
+      measurements[thread_id] =
+          measure(range.second - range.first, [&]() { function(range.first, range.second, recorders[thread_id]); });
+    });
+
+    for (const auto& recorder : recorders) {
+      latencies.merge(recorder.histogram());
+    }
+    return measurements;
+  }
+
+  // Like execute above, but executes the items for the time bound if it is enabled. Each thread calls
+  // function(begin, end, recorder) for chunks of up to chunk_size items of its range. The chunks of the warm-up get a
+  // disabled recorder and are not measured. If repeatable is true, e.g., for lookups, a thread starts again with the
+  // first item of its range after its last one. Otherwise, it stops after its last item, even if the time is not over.
+  // All threads stop early if the throughput converged to the target relative error of the time bound. The
+  // measurements contain the operations after the warm-up, and the throughput series the operations of all threads per
+  // time bucket.
+  template <typename Function>
+  static std::vector<Measurements> execute(const size_t thread_count, const size_t item_count,
+                                           const bool record_latencies, const TimeBound& time_bound,
+                                           const bool repeatable, LatencyHistogram& latencies,
+                                           ThroughputSeries& throughput_series, const Function& function,
+                                           const size_t chunk_size = CHUNK_SIZE) {
+    if (!time_bound.enabled()) {
+      return execute(thread_count, item_count, record_latencies, latencies, function);
+    }
+
+    auto recorders = std::vector<LatencyRecorder>{};
+    recorders.reserve(thread_count);
+    for (size_t thread_id = 0; thread_id < thread_count; ++thread_id) {
+      recorders.emplace_back(record_latencies);
+    }
+
+    auto monitor = ThroughputMonitor{time_bound};
+    auto stop = std::atomic<bool>{false};
+    const auto end_time = std::chrono::nanoseconds{time_bound.warm_up + time_bound.duration};
+    auto measurements = std::vector<Measurements>(thread_count);
+    auto elapsed_times = std::vector<std::chrono::nanoseconds>(thread_count);
+    _run(thread_count, item_count, [&](const size_t thread_id, const std::pair<size_t, size_t> range) {
+      const auto start_time = std::chrono::steady_clock::now();
+      auto& elapsed = elapsed_times[thread_id];
+      auto next_item = range.first;
+      // executes the next chunk and returns its number of items, 0 if the range is exhausted
+      const auto execute_chunk = [&](LatencyRecorder& recorder) {
+        if (next_item == range.second) {
+          if (!repeatable || range.first == range.second) {
+            return size_t{0};
+          }
+          next_item = range.first;
+        }
+        const auto chunk_end = std::min(next_item + chunk_size, range.second);
+        function(next_item, chunk_end, recorder);
+        elapsed = std::chrono::steady_clock::now() - start_time;
+        monitor.add(elapsed, chunk_end - next_item);
+        const auto chunk_item_count = chunk_end - next_item;
+        next_item = chunk_end;
+        return chunk_item_count;
+      };
+
+      auto warm_up_recorder = LatencyRecorder{false};
+      while (!stop.load(std::memory_order_relaxed) && elapsed < time_bound.warm_up &&
+             execute_chunk(warm_up_recorder) > 0) {
+        // warm up
+      }
+      auto operation_count = size_t{0};
+      auto checked_bucket = size_t{0};
+      measurements[thread_id] = measure(0, [&]() {
+        while (!stop.load(std::memory_order_relaxed) && elapsed < end_time) {
+          const auto chunk_item_count = execute_chunk(recorders[thread_id]);
+          if (chunk_item_count == 0) {
+            break;
+          }
+          operation_count += chunk_item_count;
+          // the first thread checks the convergence once per bucket
+          const auto bucket = static_cast<size_t>(elapsed / time_bound.bucket_duration);
+          if (thread_id == 0 && bucket > checked_bucket) {
+            checked_bucket = bucket;
+            if (monitor.converged(elapsed)) {
+              stop.store(true, std::memory_order_relaxed);
+            }
+          }
+        }
+      });
+      measurements[thread_id].operation_count = operation_count;
+    });
+
+    for (const auto& recorder : recorders) {
+      latencies.merge(recorder.histogram());
+    }
+    throughput_series = monitor.series(*std::max_element(elapsed_times.cbegin(), elapsed_times.cend()));
+    return measurements;
+  }
+
+  // Measures the duration of function() and counts its hardware events in the calling thread. The function executes
+  // operation_count index operations. The index size is not measured. Opening the performance counters is not
+  // included in the duration.
+  template <typename Function>
+  static Measurements measure(const size_t operation_count, const Function& function) {
+    auto counters = PerformanceCounters{};
+    counters.start();
+    Timer timer{};
+    function();
+    const auto duration = timer.lap();
+    const auto event_counts = counters.stop();
+    return Measurements{duration, 0, operation_count, event_counts};
+  }
+
+  // returns the range [begin, end) of the items that are processed by the given thread. The first
+  // item_count % thread_count threads process one item more than the remaining threads.
+  static std::pair<size_t, size_t> partition(const size_t thread_count, const size_t item_count,
+                                             const size_t thread_id) {
+    const auto items_per_thread = item_count / thread_count;
+    const auto remainder = item_count % thread_count;
+    const auto begin = thread_id * items_per_thread + std::min(thread_id, remainder);
+    const auto end = begin + items_per_thread + (thread_id < remainder ? 1 : 0);
+    return {begin, end};
+  }
+
+  // the default number of items that a thread executes between two checks of the time bound
+  static constexpr size_t CHUNK_SIZE = 64;
+
+ protected:
+  // Calls run_thread(thread_id, range) for each thread with the range of its items. All threads are started at the
+  // same time after they were spawned. A single thread is executed in the calling thread.
+  template <typename Function>
+  static void _run(const size_t thread_count, const size_t item_count, const Function& run_thread) {
+    if (thread_count == 1) {
+      run_thread(size_t{0}, partition(1, item_count, 0));
+      return;
+    }
+
+    auto start_latch = std::latch{static_cast<std::ptrdiff_t>(thread_count)};
+    auto threads = std::vector<std::thread>{};
+    threads.reserve(thread_count);
+    for (size_t thread_id = 0; thread_id < thread_count; ++thread_id) {
+      const auto range = partition(thread_count, item_count, thread_id);
+      threads.emplace_back([&, thread_id, range]() {
+        start_latch.arrive_and_wait();
+        run_thread(thread_id, range);
+      });
+    }
+
+    for (auto& thread : threads) {
+      thread.join();
+    }
+  }
+};
+
+}  // namespace imib
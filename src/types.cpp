@@ -2,6 +2,7 @@
 
 #include <cstdint>
 #include <string>
+#include <string_view>
 
 namespace {
 
@@ -25,4 +26,10 @@ TYPE_SPECIALIZATION(float);
 TYPE_SPECIALIZATION(double);
 TYPE_SPECIALIZATION(string);
 
+// string keys are views into the data (see DataGenerator), but named like the key type of the benchmark plan
+template <>
+const std::string Type<std::string_view>::name() {
+  return "string";
+}
+
 }  // namespace imib
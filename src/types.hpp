@@ -1,24 +1,144 @@
 #pragma once
 
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <span>
 #include <string>
 #include <tuple>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace imib {
 
+// The index entries and the other representations of the keys that the benchmark cases and competitors use. Data
+// is either created from the source keys or with given representations. The representations of the source keys are
+// materialized on their first access, thus, only the representations that the executed cases and competitors use
+// occupy memory. The first access may happen concurrently. Copies share the source keys and the representations.
 template <typename Key, typename Value>
-struct Data {
-  std::vector<Key> keys;
-  std::vector<Value> values;
-  std::vector<std::pair<Key, Value>> entries;
-  // BBTree is a multidimensional index structure. We used with one dimension. Thus, it requires a one dimensional
-  // float vectors as keys
-  std::vector<std::vector<float>> keys_float;
-
-  Data() = default;
-  explicit Data(const std::vector<Key> p_keys, const std::vector<Value> p_values,
-                const std::vector<std::pair<Key, Value>> p_entries, const std::vector<std::vector<float>> p_keys_float)
-      : keys(p_keys), values(p_values), entries(p_entries), keys_float(p_keys_float) {}
+class Data {
+ public:
+  Data() : _representations(std::make_shared<Representations>()) {}
+
+  // The values are the positions of the keys, starting at 1. The source owner keeps the source keys alive, e.g., the
+  // memory-mapped file that contains them.
+  Data(const std::span<const Key> source_keys, std::shared_ptr<const void> source_owner)
+      : _representations(std::make_shared<Representations>()) {
+    static_assert(std::is_same_v<Value, uint32_t> || std::is_same_v<Value, uint64_t>,
+                  "Only uint32_t or uint64_t values are supported so far.");
+    _representations->source_keys = source_keys;
+    _representations->source_owner = std::move(source_owner);
+  }
+
+  // the given representations are used as they are, e.g., for test data whose values are not the key positions
+  explicit Data(std::vector<Key> p_keys, std::vector<Value> p_values, std::vector<std::pair<Key, Value>> p_entries,
+                std::vector<float> p_keys_float)
+      : _representations(std::make_shared<Representations>()) {
+    _representations->keys = std::move(p_keys);
+    _representations->values = std::move(p_values);
+    _representations->entries = std::move(p_entries);
+    _representations->keys_float = std::move(p_keys_float);
+    _representations->given = true;
+  }
+
+  const std::vector<Key>& keys() const {
+    return _materialize(_representations->keys, _representations->keys_materialized, [](auto& keys, auto source) {
+      keys.assign(source.begin(), source.end());
+    });
+  }
+
+  const std::vector<Value>& values() const {
+    return _materialize(_representations->values, _representations->values_materialized,
+                        [](auto& values, auto source) {
+                          values.resize(source.size());
+                          std::iota(values.begin(), values.end(), 1);
+                        });
+  }
+
+  const std::vector<std::pair<Key, Value>>& entries() const {
+    return _materialize(_representations->entries, _representations->entries_materialized,
+                        [](auto& entries, auto source) {
+                          entries.reserve(source.size());
+                          for (size_t position = 0; position < source.size(); ++position) {
+                            entries.emplace_back(source[position], static_cast<Value>(position + 1));
+                          }
+                        });
+  }
+
+  // Returns whether each key of the entries occurs only once, which is computed on the first call. Strictly ascending
+  // keys, e.g., of a sorted data file, are unique without sorting a copy of the keys. The source keys are checked
+  // directly, thus, neither the keys nor the entries are materialized for it.
+  bool unique_keys() const {
+    std::call_once(_representations->unique_keys_computed, [&] {
+      auto sorted_keys = std::vector<Key>{};
+      if (_representations->given) {
+        sorted_keys.reserve(entries().size());
+        for (const auto& entry : entries()) {
+          sorted_keys.push_back(entry.first);
+        }
+      } else {
+        const auto source_keys = _representations->source_keys;
+        if (std::adjacent_find(source_keys.begin(), source_keys.end(), std::greater_equal<Key>{}) ==
+            source_keys.end()) {
+          _representations->unique_keys = true;
+          return;
+        }
+        sorted_keys.assign(source_keys.begin(), source_keys.end());
+      }
+      std::sort(sorted_keys.begin(), sorted_keys.end());
+      _representations->unique_keys =
+          std::adjacent_find(sorted_keys.cbegin(), sorted_keys.cend()) == sorted_keys.cend();
+    });
+    return _representations->unique_keys;
+  }
+
+  // BBTree is a multidimensional index structure. We use it with one dimension, thus, each key is one float.
+  const std::vector<float>& keys_float() const {
+    return _materialize(_representations->keys_float, _representations->keys_float_materialized,
+                        [](auto& keys_float, auto source) {
+                          keys_float.reserve(source.size());
+                          for (const auto& key : source) {
+                            // narrowing issue! Key could exceed float max values
+                            keys_float.push_back(static_cast<float>(key));
+                          }
+                        });
+  }
+
+ private:
+  struct Representations {
+    std::span<const Key> source_keys;
+    std::shared_ptr<const void> source_owner;
+    // true if the representations were passed instead of the source keys
+    bool given = false;
+
+    std::vector<Key> keys;
+    std::vector<Value> values;
+    std::vector<std::pair<Key, Value>> entries;
+    std::vector<float> keys_float;
+    std::once_flag keys_materialized;
+    std::once_flag values_materialized;
+    std::once_flag entries_materialized;
+    std::once_flag keys_float_materialized;
+    bool unique_keys = true;
+    std::once_flag unique_keys_computed;
+  };
+
+  template <typename Representation, typename Materialize>
+  const Representation& _materialize(Representation& representation, std::once_flag& materialized,
+                                     const Materialize& materialize) const {
+    if (!_representations->given) {
+      std::call_once(materialized, [&] { materialize(representation, _representations->source_keys); });
+    }
+    return representation;
+  }
+
+  std::shared_ptr<Representations> _representations;
 };
 
 template <typename Key, typename Value>
@@ -49,26 +169,121 @@ enum class ValueType {
   // RowID
 };
 
-struct BenchmarkConfiguration {
-  size_t iterations;
-  size_t threads;
+enum class DistributionType { Normal, Uniform, Zipfian, Hotspot, Latest };
+
+// The distribution from which keys or lookups are generated instead of being read from a file. The seed makes the
+// generated keys reproducible.
+struct KeyDistribution {
+  DistributionType type{DistributionType::Uniform};
+  uint64_t seed{0};
+  // the number of keys, equality lookups, or range lookups to generate
+  size_t count{0};
+  // Zipfian and Latest: the exponent of the Zipf distribution, YCSB uses 0.99
+  double skew{0.99};
+  // Hotspot: the share of the draws that hit the hot set, and the share of the keys that form the hot set
+  double hot_probability{0.8};
+  double hot_fraction{0.2};
+  // Normal: the standard deviation relative to the number of keys
+  double standard_deviation{0.1};
+  // If not 0, the keys are drawn with duplicates from the first distinct_count keys of the domain instead of unique
+  // keys from the whole domain, e.g., count / distinct_count duplicates per key for a non-unique secondary index.
+  uint64_t distinct_count{0};
+};
+
+// The binary files of the index entries and of the lookups that are executed on them. If a file name is empty, the
+// keys or lookups are generated from the corresponding distribution instead.
+struct DatasetConfiguration {
   std::string data_file;
   std::string equality_lookup_file;
   std::string range_lookup_file;
+  KeyDistribution key_distribution{};
+  KeyDistribution equality_lookup_distribution{};
+  KeyDistribution range_lookup_distribution{};
+  // the number of consecutive keys that a generated range lookup spans
+  size_t range_lookup_size{100};
+  // how the data and lookup files are mapped, see MappingOptions
+  bool populate{false};
+  bool huge_pages{false};
+};
+
+// Selects a benchmark case by its name for the indexes with the given names. Without index names, the case is
+// executed for all registered indexes that support its operation.
+struct CaseSelection {
+  std::string case_name;
+  std::vector<std::string> index_names;
+};
+
+// The shares of the index operations of a mixed workload, relative to their sum, e.g., 95 equality lookups and 5
+// updates. An update erases an entry and inserts it again, like the maintenance of a secondary index when the indexed
+// attribute of a row is updated.
+struct WorkloadMix {
+  std::string name;
+  uint32_t equality_lookups{0};
+  uint32_t range_lookups{0};
+  uint32_t inserts{0};
+  uint32_t updates{0};
+};
+
+// Executes the operations of a case for a fixed time instead of once, e.g., to measure the sustained throughput on
+// small datasets or its decay while an index grows. The lookups are repeated until the time is over, while the
+// operations that change the index, e.g., inserts, end when all of them were executed.
+struct TimeBound {
+  // the measured time after the warm-up, 0 executes each operation once
+  std::chrono::milliseconds duration{0};
+  // the operations of the warm-up are neither measured nor recorded
+  std::chrono::milliseconds warm_up{0};
+  // the throughput is reported per bucket of this duration
+  std::chrono::milliseconds bucket_duration{100};
+  // If not 0, the execution ends before the duration is over when the 95% confidence interval of the bucket
+  // throughputs is narrower than this share of their mean.
+  double target_relative_error{0.0};
+
+  bool enabled() const { return duration.count() > 0; }
+};
+
+// Each selected case is executed for each combination of key type and dataset.
+struct BenchmarkConfiguration {
+  size_t iterations;
+  size_t threads;
+  std::vector<std::string> key_types;
+  std::vector<DatasetConfiguration> datasets;
+  std::vector<CaseSelection> cases;
   std::string output_file_name;
+  // records the latency of each index operation in addition to the durations of the threads
+  bool record_latencies{false};
+  // a MixedWorkload case is registered for each mix
+  std::vector<WorkloadMix> workload_mixes;
+  TimeBound time_bound{};
+  // the share of the entries that the BulkErase case erases
+  double bulk_erase_fraction{0.1};
 };
 
 enum class IndexType {
   ART,
+  ARTOLC,
+  ARTPostingList,
+  ARTReference,
   BTreeAbseil,
+  BTreeAbseilMultimap,
   BTreeTLX,
+  BTreeTLXMultimap,
+  BTreeTLXPartitioned,
+  BwTree,
+  ColumnarSortedVector,
+  CSSL,
+  EytzingerArray,
   BBTree,
   RobinHoodFlatMap,
   RobinHoodNodeMap,
+  RobinHoodPostingListMap,
   RobinMapTSL,
   SparseMapTSL,
+  ShardedHashMap,
   JudyArray,
+  Masstree,
+  PiecewiseLinearIndex,
   SimpleVector,
+  SimdSortedVector,
   SkipList,
   SortedVector,
   UnorderedMap
@@ -0,0 +1,25 @@
+#pragma once
+
+namespace imib {
+
+// The hash maps have no key order that a range erase could exploit, thus, their bulk erases erase the keys one by one.
+// In contrast to single erases, a bulk erase afterwards shrinks the table to the remaining entries if it is less than
+// a quarter as full as its maximum load factor allows, e.g., after the drop of a large partition. Thus, the memory of
+// the erased slots is returned to the allocator.
+class HashMapShrinking {
+ public:
+  HashMapShrinking() = delete;
+
+  template <typename Map>
+  static void shrink_after_bulk_erase(Map& map) {
+    if (map.load_factor() < map.max_load_factor() * SHRINK_LOAD_FACTOR_SHARE) {
+      map.rehash(0);
+    }
+  }
+
+ protected:
+  // the table is shrunk if its load factor falls below this share of the maximum load factor
+  static constexpr float SHRINK_LOAD_FACTOR_SHARE = 0.25f;
+};
+
+}  // namespace imib
@@ -0,0 +1,108 @@
+#pragma once
+
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+#include <type_traits>
+
+namespace imib {
+
+// Encodes keys into binary-comparable byte strings, i.e., comparing two encoded keys with memcmp yields the order of
+// the keys. Tries like the ART branch on the key bytes from the first to the last byte, thus, they only return the
+// keys of a range lookup in their order and compress common prefixes of neighboring keys if the keys are encoded.
+// - unsigned integers are stored in big-endian byte order, i.e., the most significant byte first
+// - signed integers additionally flip the sign bit, thus, negative keys are ordered before positive keys
+// - floating point numbers flip the sign bit of positive numbers and all bits of negative numbers, since the magnitude
+//   of negative numbers is ordered inversely, NaNs are ordered before (negative NaN) or after (positive NaN) all
+//   other numbers
+// - strings are stored with a terminating 0 byte, thus, no key is a prefix of another key, which the ART requires.
+//   Therefore, the strings must not contain 0 bytes.
+class KeyEncoding {
+ public:
+  KeyEncoding() = delete;
+
+  // returns the number of bytes of the encoded key
+  template <typename Key>
+  static size_t size(const Key& key) {
+    if constexpr (std::is_same_v<Key, std::string_view>) {
+      return key.size() + 1;
+    } else {
+      return sizeof(Key);
+    }
+  }
+
+  // writes the size(key) bytes of the encoded key to key_bytes
+  template <typename Key>
+  static void encode(const Key& key, uint8_t* key_bytes) {
+    if constexpr (std::is_same_v<Key, std::string_view>) {
+      std::memcpy(key_bytes, key.data(), key.size());
+      key_bytes[key.size()] = 0;
+    } else {
+      _store_big_endian(_to_ordered_bits(key), key_bytes);
+    }
+  }
+
+  // reads a fixed-length key from its encoded bytes
+  template <typename Key>
+  static Key decode(const uint8_t* key_bytes) {
+    static_assert(!std::is_same_v<Key, std::string_view>, "Encoded strings are decoded by dropping the last byte.");
+    return _from_ordered_bits<Key>(_load_big_endian<_Bits<Key>>(key_bytes));
+  }
+
+ protected:
+  // the unsigned integer type with the size of the key
+  template <typename Key>
+  using _Bits = std::conditional_t<sizeof(Key) == 8, uint64_t,
+                                   std::conditional_t<sizeof(Key) == 4, uint32_t,
+                                                      std::conditional_t<sizeof(Key) == 2, uint16_t, uint8_t>>>;
+
+  template <typename Key>
+  static _Bits<Key> _to_ordered_bits(const Key key) {
+    static_assert(std::is_arithmetic_v<Key>, "Only arithmetic keys and strings can be encoded.");
+    using Bits = _Bits<Key>;
+    constexpr auto sign_bit = Bits{1} << (sizeof(Key) * 8 - 1);
+    const auto bits = std::bit_cast<Bits>(key);
+    if constexpr (std::is_floating_point_v<Key>) {
+      return (bits & sign_bit) ? static_cast<Bits>(~bits) : static_cast<Bits>(bits | sign_bit);
+    } else if constexpr (std::is_signed_v<Key>) {
+      return static_cast<Bits>(bits ^ sign_bit);
+    } else {
+      return bits;
+    }
+  }
+
+  template <typename Key>
+  static Key _from_ordered_bits(const _Bits<Key> ordered_bits) {
+    using Bits = _Bits<Key>;
+    constexpr auto sign_bit = Bits{1} << (sizeof(Key) * 8 - 1);
+    if constexpr (std::is_floating_point_v<Key>) {
+      return std::bit_cast<Key>((ordered_bits & sign_bit) ? static_cast<Bits>(ordered_bits ^ sign_bit)
+                                                           : static_cast<Bits>(~ordered_bits));
+    } else if constexpr (std::is_signed_v<Key>) {
+      return std::bit_cast<Key>(static_cast<Bits>(ordered_bits ^ sign_bit));
+    } else {
+      return ordered_bits;
+    }
+  }
+
+  template <std::unsigned_integral Bits>
+  static void _store_big_endian(const Bits bits, uint8_t* key_bytes) {
+    for (size_t byte_index = 0; byte_index < sizeof(Bits); ++byte_index) {
+      key_bytes[byte_index] = static_cast<uint8_t>(bits >> ((sizeof(Bits) - 1 - byte_index) * 8));
+    }
+  }
+
+  template <std::unsigned_integral Bits>
+  static Bits _load_big_endian(const uint8_t* key_bytes) {
+    auto bits = Bits{0};
+    for (size_t byte_index = 0; byte_index < sizeof(Bits); ++byte_index) {
+      bits = static_cast<Bits>((bits << 8) | key_bytes[byte_index]);
+    }
+    return bits;
+  }
+};
+
+}  // namespace imib
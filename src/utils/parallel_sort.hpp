@@ -0,0 +1,311 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace imib {
+
+// Sorts the entries of the bulk operations with all cores, e.g., before the bottom-up build of a sorted array or the
+// bulk load of a B+-tree. The entries are sorted by key and value.
+// Unsigned integer keys are sorted by a parallel LSD radix sort: each pass distributes the entries by one digit of
+// RADIX_BITS bits of the key, starting with the least significant digit. Each thread counts the digits of its range of
+// the entries, thus, the prefix sums of the counts of all threads yield the position of each thread's entries per
+// digit, and the threads scatter their entries without synchronization. Passes whose digit is the same for all keys
+// are skipped, e.g., the upper digits of dense keys. The sort is stable, thus, only the runs of equal keys are sorted
+// by value afterwards.
+// Other keys, e.g., strings, are sorted by std::sort per thread and merged pairwise. All threads take part in each
+// merge: the merge path of two sorted runs is split into equal parts by a binary search for the number of entries of
+// the left run in each part, and each thread merges its part into a buffer.
+class ParallelSort {
+ public:
+  ParallelSort() = delete;
+
+  template <typename Key, typename Value>
+  static void sort(std::vector<std::pair<Key, Value>>& entries) {
+    sort(entries, _thread_count(entries.size()));
+  }
+
+  // sorts with the given number of threads instead of one thread per core
+  template <typename Key, typename Value>
+  static void sort(std::vector<std::pair<Key, Value>>& entries, const size_t thread_count) {
+    if (thread_count <= 1 || entries.size() < thread_count) {
+      std::sort(entries.begin(), entries.end());
+    } else if constexpr (std::unsigned_integral<Key>) {
+      _radix_sort(entries, thread_count);
+    } else {
+      _merge_sort(entries, thread_count);
+    }
+  }
+
+  // Merges the sorted ranges [0, middle) and [middle, size) of the entries with all cores, e.g., the stored entries of
+  // a sorted array with the sorted inserted entries.
+  template <typename Key, typename Value>
+  static void merge(std::vector<std::pair<Key, Value>>& entries, const size_t middle) {
+    merge(entries, middle, _thread_count(entries.size()));
+  }
+
+  // merges with the given number of threads instead of one thread per core
+  template <typename Key, typename Value>
+  static void merge(std::vector<std::pair<Key, Value>>& entries, const size_t middle, const size_t thread_count) {
+    if (thread_count <= 1 || entries.size() < thread_count) {
+      std::inplace_merge(entries.begin(), entries.begin() + middle, entries.end());
+      return;
+    }
+    auto buffer = std::vector<std::pair<Key, Value>>(entries.size());
+    _merge_runs(entries, buffer, {0, middle, entries.size()}, thread_count);
+    entries.swap(buffer);
+  }
+
+  // Calls function(begin, end) for contiguous ranges of the items in parallel, e.g., to copy the sorted entries into
+  // the columns of an index. Small ranges are processed by the calling thread.
+  template <typename Function>
+  static void for_each_range(const size_t item_count, const Function& function) {
+    _run(_thread_count(item_count), item_count,
+         [&](const size_t /*thread_id*/, const size_t begin, const size_t end) { function(begin, end); });
+  }
+
+  // the number of ranges that for_each_range splits the items into, i.e., the number of threads that process them
+  static size_t range_count(const size_t item_count) { return _thread_count(item_count); }
+
+  // Calls function(range_id, begin, end) for range_count contiguous ranges of the items in parallel, e.g., to build a
+  // partition of an index per range.
+  template <typename Function>
+  static void for_each_range(const size_t item_count, const size_t range_count, const Function& function) {
+    _run(range_count, item_count, function);
+  }
+
+ protected:
+  // the minimum number of items per thread, a thread per fewer items would cost more than it saves
+  static constexpr size_t MIN_ITEMS_PER_THREAD = size_t{1} << 14;
+
+  // 11 bits need 6 passes for 64-bit keys instead of 8 passes with bytes, while the 2048 target positions of a thread
+  // still fit into the L1 cache
+  static constexpr size_t RADIX_BITS = 11;
+  static constexpr size_t RADIX_SIZE = size_t{1} << RADIX_BITS;
+
+  using Histogram = std::array<size_t, RADIX_SIZE>;
+
+  static size_t _thread_count(const size_t item_count) {
+    const auto core_count = std::max(size_t{std::thread::hardware_concurrency()}, size_t{1});
+    return std::clamp(item_count / MIN_ITEMS_PER_THREAD, size_t{1}, core_count);
+  }
+
+  // Calls function(thread_id, begin, end) for each thread with the range of its items. The first
+  // item_count % thread_count threads process one item more than the remaining threads. A single thread is executed
+  // in the calling thread.
+  template <typename Function>
+  static void _run(const size_t thread_count, const size_t item_count, const Function& function) {
+    const auto range = [&](const size_t thread_id) {
+      const auto items_per_thread = item_count / thread_count;
+      const auto remainder = item_count % thread_count;
+      const auto begin = thread_id * items_per_thread + std::min(thread_id, remainder);
+      return std::pair<size_t, size_t>{begin, begin + items_per_thread + (thread_id < remainder ? 1 : 0)};
+    };
+    if (thread_count == 1) {
+      function(size_t{0}, size_t{0}, item_count);
+      return;
+    }
+
+    auto threads = std::vector<std::thread>{};
+    threads.reserve(thread_count - 1);
+    for (size_t thread_id = 1; thread_id < thread_count; ++thread_id) {
+      threads.emplace_back([&, thread_id]() {
+        const auto [begin, end] = range(thread_id);
+        function(thread_id, begin, end);
+      });
+    }
+    const auto [begin, end] = range(0);
+    function(size_t{0}, begin, end);
+    for (auto& thread : threads) {
+      thread.join();
+    }
+  }
+
+  template <typename Key>
+  static size_t _digit(const Key key, const size_t pass) {
+    return static_cast<size_t>((key >> (pass * RADIX_BITS)) & (RADIX_SIZE - 1));
+  }
+
+  template <typename Key, typename Value>
+  static void _radix_sort(std::vector<std::pair<Key, Value>>& entries, const size_t thread_count) {
+    constexpr auto pass_count = (sizeof(Key) * 8 + RADIX_BITS - 1) / RADIX_BITS;
+    const auto entry_count = entries.size();
+
+    // a pass is skipped if all keys have the same digit, i.e., no key differs from the first key in the digit's bits
+    auto pass_required = std::array<bool, pass_count>{};
+    {
+      const auto first_key = entries.front().first;
+      auto differing_bits = std::vector<Key>(thread_count);
+      _run(thread_count, entry_count, [&](const size_t thread_id, const size_t begin, const size_t end) {
+        auto bits = Key{0};
+        for (auto position = begin; position < end; ++position) {
+          bits |= entries[position].first ^ first_key;
+        }
+        differing_bits[thread_id] = bits;
+      });
+      auto bits = Key{0};
+      for (const auto thread_bits : differing_bits) {
+        bits |= thread_bits;
+      }
+      for (size_t pass = 0; pass < pass_count; ++pass) {
+        pass_required[pass] = _digit(bits, pass) != 0;
+      }
+    }
+
+    auto buffer = std::vector<std::pair<Key, Value>>(entry_count);
+    auto* source = &entries;
+    auto* target = &buffer;
+    auto histograms = std::vector<Histogram>(thread_count);
+    for (size_t pass = 0; pass < pass_count; ++pass) {
+      if (!pass_required[pass]) {
+        continue;
+      }
+      _run(thread_count, entry_count, [&](const size_t thread_id, const size_t begin, const size_t end) {
+        auto& histogram = histograms[thread_id];
+        histogram.fill(0);
+        for (auto position = begin; position < end; ++position) {
+          ++histogram[_digit((*source)[position].first, pass)];
+        }
+      });
+
+      // the histograms become the first target position of each thread per digit: the entries of smaller digits, then
+      // the entries of the same digit of the threads before
+      auto offset = size_t{0};
+      for (size_t digit = 0; digit < RADIX_SIZE; ++digit) {
+        for (auto& histogram : histograms) {
+          const auto count = histogram[digit];
+          histogram[digit] = offset;
+          offset += count;
+        }
+      }
+
+      _run(thread_count, entry_count, [&](const size_t thread_id, const size_t begin, const size_t end) {
+        auto& positions = histograms[thread_id];
+        for (auto position = begin; position < end; ++position) {
+          auto& entry = (*source)[position];
+          (*target)[positions[_digit(entry.first, pass)]++] = std::move(entry);
+        }
+      });
+      std::swap(source, target);
+    }
+    if (source != &entries) {
+      entries.swap(buffer);
+    }
+
+    // each thread sorts the runs of equal keys that start in its range by value
+    _run(thread_count, entry_count, [&](const size_t /*thread_id*/, const size_t begin, const size_t end) {
+      for (auto run_begin = begin; run_begin < end;) {
+        if (run_begin > 0 && entries[run_begin - 1].first == entries[run_begin].first) {
+          ++run_begin;
+          continue;
+        }
+        auto run_end = run_begin + 1;
+        while (run_end < entry_count && entries[run_end].first == entries[run_begin].first) {
+          ++run_end;
+        }
+        if (run_end - run_begin > 1) {
+          std::sort(entries.begin() + run_begin, entries.begin() + run_end);
+        }
+        run_begin = run_end;
+      }
+    });
+  }
+
+  template <typename Key, typename Value>
+  static void _merge_sort(std::vector<std::pair<Key, Value>>& entries, const size_t thread_count) {
+    // the sorted runs of the threads, then merged pairwise in parallel until one run remains
+    auto run_bounds = std::vector<size_t>(thread_count + 1);
+    _run(thread_count, entries.size(), [&](const size_t thread_id, const size_t begin, const size_t end) {
+      std::sort(entries.begin() + begin, entries.begin() + end);
+      run_bounds[thread_id + 1] = end;
+    });
+
+    auto buffer = std::vector<std::pair<Key, Value>>(entries.size());
+    while (run_bounds.size() > 2) {
+      _merge_runs(entries, buffer, run_bounds, thread_count);
+      entries.swap(buffer);
+      auto merged_bounds = std::vector<size_t>{};
+      for (size_t bound = 0; bound < run_bounds.size(); bound += 2) {
+        merged_bounds.push_back(run_bounds[bound]);
+      }
+      if (merged_bounds.back() != run_bounds.back()) {
+        merged_bounds.push_back(run_bounds.back());
+      }
+      run_bounds = std::move(merged_bounds);
+    }
+  }
+
+  // Merges each pair of adjacent sorted runs of the source into the target with thread_count threads, an odd last
+  // run is moved. The runs are given by their bounds. Each thread writes one contiguous range of the target, i.e., it
+  // merges the entries of both runs between the split of the merge at its first target position and the split at the
+  // next thread's first target position. All splits are searched before any entry is moved.
+  template <typename Entry>
+  static void _merge_runs(std::vector<Entry>& source, std::vector<Entry>& target, const std::vector<size_t>& run_bounds,
+                          const size_t thread_count) {
+    const auto merge_count = run_bounds.size() / 2;
+    const auto merge_bounds = [&](const size_t merge_id) {
+      const auto middle = run_bounds[2 * merge_id + 1];
+      const auto end = 2 * merge_id + 2 < run_bounds.size() ? run_bounds[2 * merge_id + 2] : middle;
+      return std::array<size_t, 3>{run_bounds[2 * merge_id], middle, end};
+    };
+
+    // the number of entries of the left run of each merge that precede the first target position of each thread
+    auto left_counts = std::vector<size_t>((thread_count + 1) * merge_count);
+    _run(thread_count, source.size(), [&](const size_t thread_id, const size_t begin, const size_t /*end*/) {
+      for (size_t merge_id = 0; merge_id < merge_count; ++merge_id) {
+        const auto [merge_begin, middle, merge_end] = merge_bounds(merge_id);
+        left_counts[thread_id * merge_count + merge_id] =
+            _merge_left_count(source.cbegin() + merge_begin, middle - merge_begin, source.cbegin() + middle,
+                              merge_end - middle, std::clamp(begin, merge_begin, merge_end) - merge_begin);
+      }
+    });
+    for (size_t merge_id = 0; merge_id < merge_count; ++merge_id) {
+      const auto [merge_begin, middle, merge_end] = merge_bounds(merge_id);
+      left_counts[thread_count * merge_count + merge_id] = middle - merge_begin;
+    }
+
+    _run(thread_count, source.size(), [&](const size_t thread_id, const size_t begin, const size_t end) {
+      for (size_t merge_id = 0; merge_id < merge_count; ++merge_id) {
+        const auto [merge_begin, middle, merge_end] = merge_bounds(merge_id);
+        const auto target_begin = std::clamp(begin, merge_begin, merge_end);
+        const auto target_end = std::clamp(end, merge_begin, merge_end);
+        const auto left_begin = left_counts[thread_id * merge_count + merge_id];
+        const auto left_end = left_counts[(thread_id + 1) * merge_count + merge_id];
+        const auto right_begin = target_begin - merge_begin - left_begin;
+        const auto right_end = target_end - merge_begin - left_end;
+        std::merge(std::make_move_iterator(source.begin() + merge_begin + left_begin),
+                   std::make_move_iterator(source.begin() + merge_begin + left_end),
+                   std::make_move_iterator(source.begin() + middle + right_begin),
+                   std::make_move_iterator(source.begin() + middle + right_end), target.begin() + target_begin);
+      }
+    });
+  }
+
+  // Returns the number of entries of the sorted left range among the first output_count entries of its merge with the
+  // sorted right range. Like std::merge, equal entries of the left range precede those of the right range.
+  template <typename Iterator>
+  static size_t _merge_left_count(const Iterator left, const size_t left_size, const Iterator right,
+                                  const size_t right_size, const size_t output_count) {
+    auto low = output_count > right_size ? output_count - right_size : size_t{0};
+    auto high = std::min(output_count, left_size);
+    while (low < high) {
+      const auto left_count = low + (high - low) / 2;
+      const auto right_count = output_count - left_count;
+      if (right_count > 0 && !(right[right_count - 1] < left[left_count])) {
+        low = left_count + 1;
+      } else {
+        high = left_count;
+      }
+    }
+    return low;
+  }
+};
+
+}  // namespace imib
@@ -0,0 +1,187 @@
+#pragma once
+
+#include <immintrin.h>  // x86 AVX2 and AVX-512 intrinsics
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace imib {
+
+enum class SimdInstructionSet { Scalar, AVX2, AVX512 };
+
+// Searches in sorted arrays of unsigned 32-bit or 64-bit keys with SIMD instructions. The instruction set is selected
+// at runtime, thus, the binary also runs on CPUs without AVX2 or AVX-512 by falling back to std::lower_bound and
+// std::upper_bound.
+// K-ary search: in each step, the key is compared with the k - 1 pivots that split the remaining range into k parts of
+// equal size. The k - 1 = LANES pivots are compared with one SIMD instruction, and the number of pivots that are less
+// than the key is the index of the part to continue with. Thus, the range shrinks by factor k instead of 2 per step
+// and the loads of the pivots are independent. The remaining small range is scanned linearly with SIMD instructions.
+class SimdSearch {
+ public:
+  SimdSearch() = delete;
+
+  // returns the best instruction set of the CPU, which is detected once
+  static SimdInstructionSet supported_instruction_set() {
+    static const auto instruction_set = _detect_instruction_set();
+    return instruction_set;
+  }
+
+  // returns the position of the first key that is not less than the search key
+  template <typename Key>
+  static size_t lower_bound(const Key* keys, const size_t size, const Key search_key,
+                            const SimdInstructionSet instruction_set = supported_instruction_set()) {
+    return _search<false>(keys, size, search_key, instruction_set);
+  }
+
+  // returns the position of the first key that is greater than the search key
+  template <typename Key>
+  static size_t upper_bound(const Key* keys, const size_t size, const Key search_key,
+                            const SimdInstructionSet instruction_set = supported_instruction_set()) {
+    return _search<true>(keys, size, search_key, instruction_set);
+  }
+
+ protected:
+  static SimdInstructionSet _detect_instruction_set() {
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) {
+      return SimdInstructionSet::AVX512;
+    }
+    if (__builtin_cpu_supports("avx2")) {
+      return SimdInstructionSet::AVX2;
+    }
+    return SimdInstructionSet::Scalar;
+  }
+
+  // returns the position of the first key for which the predicate is false. The predicate is key < search_key for
+  // the lower bound (UpperBound = false) and key <= search_key for the upper bound (UpperBound = true).
+  template <bool UpperBound, typename Key>
+  static size_t _search(const Key* keys, const size_t size, const Key search_key,
+                        const SimdInstructionSet instruction_set) {
+    static_assert(std::is_unsigned_v<Key> && (sizeof(Key) == 4 || sizeof(Key) == 8),
+                  "SimdSearch only supports unsigned 32-bit and 64-bit keys.");
+    switch (instruction_set) {
+      case SimdInstructionSet::AVX512:
+        return _search_avx512<UpperBound>(keys, size, search_key);
+      case SimdInstructionSet::AVX2:
+        return _search_avx2<UpperBound>(keys, size, search_key);
+      case SimdInstructionSet::Scalar:
+        break;
+    }
+    if constexpr (UpperBound) {
+      return static_cast<size_t>(std::upper_bound(keys, keys + size, search_key) - keys);
+    } else {
+      return static_cast<size_t>(std::lower_bound(keys, keys + size, search_key) - keys);
+    }
+  }
+
+  template <bool UpperBound, typename Key>
+  static bool _predicate(const Key key, const Key search_key) {
+    return UpperBound ? !(search_key < key) : key < search_key;
+  }
+
+  // The functions for an instruction set are compiled for its target, independent of -march. Since lambdas do not
+  // inherit the target, the search loops call the counting functions of the same target instead.
+
+  // returns the number of keys of the 32 bytes starting at keys for which the predicate is true
+  template <bool UpperBound, typename Key>
+  __attribute__((target("avx2"))) static size_t _count_avx2(const Key* keys, const Key search_key) {
+    constexpr auto LANES = 32 / sizeof(Key);
+    const auto lanes = _mm256_loadu_si256(reinterpret_cast<const __m256i_u*>(keys));
+    // AVX2 only compares signed integers, flipping the sign bits keeps the order of the unsigned keys
+    __m256i greater;
+    if constexpr (sizeof(Key) == 4) {
+      const auto sign = _mm256_set1_epi32(INT32_MIN);
+      const auto flipped_keys = _mm256_xor_si256(lanes, sign);
+      const auto flipped_search_key = _mm256_xor_si256(_mm256_set1_epi32(static_cast<int32_t>(search_key)), sign);
+      greater = UpperBound ? _mm256_cmpgt_epi32(flipped_keys, flipped_search_key)
+                           : _mm256_cmpgt_epi32(flipped_search_key, flipped_keys);
+    } else {
+      const auto sign = _mm256_set1_epi64x(INT64_MIN);
+      const auto flipped_keys = _mm256_xor_si256(lanes, sign);
+      const auto flipped_search_key = _mm256_xor_si256(_mm256_set1_epi64x(static_cast<int64_t>(search_key)), sign);
+      greater = UpperBound ? _mm256_cmpgt_epi64(flipped_keys, flipped_search_key)
+                           : _mm256_cmpgt_epi64(flipped_search_key, flipped_keys);
+    }
+    // one mask bit per byte, i.e., sizeof(Key) bits per key
+    const auto count = static_cast<size_t>(__builtin_popcount(static_cast<uint32_t>(_mm256_movemask_epi8(greater)))) /
+                       sizeof(Key);
+    // the upper bound counts the keys that are greater than the search key
+    return UpperBound ? LANES - count : count;
+  }
+
+  template <bool UpperBound, typename Key>
+  __attribute__((target("avx512f"))) static size_t _count_avx512(const Key* keys, const Key search_key) {
+    const auto lanes = _mm512_loadu_si512(keys);
+    if constexpr (sizeof(Key) == 4) {
+      const auto search_keys = _mm512_set1_epi32(static_cast<int32_t>(search_key));
+      const auto mask = UpperBound ? _mm512_cmple_epu32_mask(lanes, search_keys)
+                                   : _mm512_cmplt_epu32_mask(lanes, search_keys);
+      return static_cast<size_t>(__builtin_popcount(mask));
+    } else {
+      const auto search_keys = _mm512_set1_epi64(static_cast<int64_t>(search_key));
+      const auto mask = UpperBound ? _mm512_cmple_epu64_mask(lanes, search_keys)
+                                   : _mm512_cmplt_epu64_mask(lanes, search_keys);
+      return static_cast<size_t>(__builtin_popcount(mask));
+    }
+  }
+
+  template <bool UpperBound, typename Key>
+  __attribute__((target("avx2"))) static size_t _search_avx2(const Key* keys, const size_t size,
+                                                             const Key search_key) {
+    constexpr auto LANES = 32 / sizeof(Key);
+    auto begin = size_t{0};
+    auto end = size;
+    while (end - begin > 4 * LANES) {
+      const auto step = (end - begin) / (LANES + 1);
+      Key pivots[LANES];
+      for (size_t lane = 0; lane < LANES; ++lane) {
+        pivots[lane] = keys[begin + (lane + 1) * step];
+      }
+      const auto part = _count_avx2<UpperBound>(pivots, search_key);
+      end = part < LANES ? begin + (part + 1) * step : end;
+      begin = part > 0 ? begin + part * step + 1 : begin;
+    }
+    for (; begin + LANES <= end; begin += LANES) {
+      const auto count = _count_avx2<UpperBound>(keys + begin, search_key);
+      if (count < LANES) {
+        return begin + count;
+      }
+    }
+    while (begin < end && _predicate<UpperBound>(keys[begin], search_key)) {
+      ++begin;
+    }
+    return begin;
+  }
+
+  template <bool UpperBound, typename Key>
+  __attribute__((target("avx512f"))) static size_t _search_avx512(const Key* keys, const size_t size,
+                                                                  const Key search_key) {
+    constexpr auto LANES = 64 / sizeof(Key);
+    auto begin = size_t{0};
+    auto end = size;
+    while (end - begin > 4 * LANES) {
+      const auto step = (end - begin) / (LANES + 1);
+      Key pivots[LANES];
+      for (size_t lane = 0; lane < LANES; ++lane) {
+        pivots[lane] = keys[begin + (lane + 1) * step];
+      }
+      const auto part = _count_avx512<UpperBound>(pivots, search_key);
+      end = part < LANES ? begin + (part + 1) * step : end;
+      begin = part > 0 ? begin + part * step + 1 : begin;
+    }
+    for (; begin + LANES <= end; begin += LANES) {
+      const auto count = _count_avx512<UpperBound>(keys + begin, search_key);
+      if (count < LANES) {
+        return begin + count;
+      }
+    }
+    while (begin < end && _predicate<UpperBound>(keys[begin], search_key)) {
+      ++begin;
+    }
+    return begin;
+  }
+};
+
+}  // namespace imib
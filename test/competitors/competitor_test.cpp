@@ -1,18 +1,38 @@
+#include <algorithm>
 #include <cassert>
+#include <span>
 #include <tuple>
+#include <string>
+#include <string_view>
 #include <type_traits>
+#include <vector>
 
 #include "gtest/gtest.h"
 
 #include "competitors/art.hpp"
+#include "competitors/art_olc.hpp"
+#include "competitors/art_posting_list.hpp"
+#include "competitors/art_reference.hpp"
 #include "competitors/b_tree_google_abseil.hpp"
+#include "competitors/b_tree_google_abseil_multimap.hpp"
 #include "competitors/b_tree_tlx.hpp"
+#include "competitors/b_tree_tlx_multimap.hpp"
+#include "competitors/b_tree_tlx_partitioned.hpp"
 #include "competitors/bb_tree.hpp"
+#include "competitors/bw_tree.hpp"
+#include "competitors/columnar_sorted_vector.hpp"
+#include "competitors/cssl.hpp"
+#include "competitors/eytzinger_array.hpp"
 #include "competitors/hash_map_robin_hood_flat.hpp"
 #include "competitors/hash_map_robin_hood_node.hpp"
+#include "competitors/hash_map_robin_hood_posting_list.hpp"
 #include "competitors/hash_map_tsl_robin.hpp"
 #include "competitors/hash_map_tsl_sparse.hpp"
 #include "competitors/judy.hpp"
+#include "competitors/masstree.hpp"
+#include "competitors/piecewise_linear_index.hpp"
+#include "competitors/sharded_hash_map.hpp"
+#include "competitors/simd_sorted_vector.hpp"
 #include "competitors/simple_vector.hpp"
 #include "competitors/skip_list.hpp"
 #include "competitors/sorted_vector.hpp"
@@ -27,31 +47,63 @@ namespace imib {
 using CompetitorTestingTypes = ::testing::Types<
   // ########## uint64 keys, uint64 values
   std::tuple<Art<uint64_t, uint64_t>, uint64_t, uint64_t>,
+  std::tuple<ArtOlc<uint64_t, uint64_t>, uint64_t, uint64_t>,
+  std::tuple<ArtPostingList<uint64_t, uint64_t>, uint64_t, uint64_t>,
+  std::tuple<ArtReference<uint64_t, uint64_t>, uint64_t, uint64_t>,
   // BB-Tree only supports uint32_t values
   // std::tuple<BbTree<uint64_t, uint64_t>, uint64_t, uint64_t>,
   std::tuple<BTreeGoogleAbseil<uint64_t, uint64_t>, uint64_t, uint64_t>,
+  std::tuple<BTreeGoogleAbseilMultimap<uint64_t, uint64_t>, uint64_t, uint64_t>,
   std::tuple<BTreeTlx<uint64_t, uint64_t>, uint64_t, uint64_t>,
+  std::tuple<BTreeTlxMultimap<uint64_t, uint64_t>, uint64_t, uint64_t>,
+  std::tuple<BTreeTlxPartitioned<uint64_t, uint64_t>, uint64_t, uint64_t>,
+  std::tuple<BwTreeIndex<uint64_t, uint64_t>, uint64_t, uint64_t>,
+  std::tuple<ColumnarSortedVector<uint64_t, uint64_t>, uint64_t, uint64_t>,
+  std::tuple<Cssl<uint64_t, uint64_t>, uint64_t, uint64_t>,
+  std::tuple<EytzingerArray<uint64_t, uint64_t>, uint64_t, uint64_t>,
   std::tuple<HashMapRobinHoodFlat<uint64_t, uint64_t>, uint64_t, uint64_t>,
   std::tuple<HashMapRobinHoodNode<uint64_t, uint64_t>, uint64_t, uint64_t>,
+  std::tuple<HashMapRobinHoodPostingList<uint64_t, uint64_t>, uint64_t, uint64_t>,
   std::tuple<HashMapTslRobin<uint64_t, uint64_t>, uint64_t, uint64_t>,
   std::tuple<HashMapTslSparse<uint64_t, uint64_t>, uint64_t, uint64_t>,
+  std::tuple<ShardedHashMap<HashMapRobinHoodFlat, uint64_t, uint64_t>, uint64_t, uint64_t>,
+  std::tuple<ShardedHashMap<HashMapTslRobin, uint64_t, uint64_t>, uint64_t, uint64_t>,
   std::tuple<Judy<uint64_t, uint64_t>, uint64_t, uint64_t>,
+  std::tuple<Masstree<uint64_t, uint64_t>, uint64_t, uint64_t>,
+  std::tuple<PiecewiseLinearIndex<uint64_t, uint64_t>, uint64_t, uint64_t>,
+  std::tuple<SimdSortedVector<uint64_t, uint64_t>, uint64_t, uint64_t>,
   std::tuple<SimpleVector<uint64_t, uint64_t>, uint64_t, uint64_t>,
   std::tuple<SkipList<uint64_t, uint64_t>, uint64_t, uint64_t>,
   std::tuple<SortedVector<uint64_t, uint64_t>, uint64_t, uint64_t>,
   std::tuple<UnorderedMap<uint64_t, uint64_t>, uint64_t, uint64_t>,
   // ########## uint32 keys, uint64 values
   std::tuple<Art<uint32_t, uint64_t>, uint32_t, uint64_t>,
+  std::tuple<ArtOlc<uint32_t, uint64_t>, uint32_t, uint64_t>,
+  std::tuple<ArtPostingList<uint32_t, uint64_t>, uint32_t, uint64_t>,
+  std::tuple<ArtReference<uint32_t, uint64_t>, uint32_t, uint64_t>,
   // BB-Tree only supports uint32_t values
   // std::tuple<BbTree<uint32_t, uint64_t>, uint32_t, uint64_t>,
   std::tuple<BTreeGoogleAbseil<uint32_t, uint64_t>, uint32_t, uint64_t>,
+  std::tuple<BTreeGoogleAbseilMultimap<uint32_t, uint64_t>, uint32_t, uint64_t>,
   std::tuple<BTreeTlx<uint32_t, uint64_t>, uint32_t, uint64_t>,
+  std::tuple<BTreeTlxMultimap<uint32_t, uint64_t>, uint32_t, uint64_t>,
+  std::tuple<BTreeTlxPartitioned<uint32_t, uint64_t>, uint32_t, uint64_t>,
+  std::tuple<BwTreeIndex<uint32_t, uint64_t>, uint32_t, uint64_t>,
+  std::tuple<ColumnarSortedVector<uint32_t, uint64_t>, uint32_t, uint64_t>,
+  std::tuple<Cssl<uint32_t, uint64_t>, uint32_t, uint64_t>,
+  std::tuple<EytzingerArray<uint32_t, uint64_t>, uint32_t, uint64_t>,
   std::tuple<HashMapRobinHoodFlat<uint32_t, uint64_t>, uint32_t, uint64_t>,
   std::tuple<HashMapRobinHoodNode<uint32_t, uint64_t>, uint32_t, uint64_t>,
+  std::tuple<HashMapRobinHoodPostingList<uint32_t, uint64_t>, uint32_t, uint64_t>,
   std::tuple<HashMapTslRobin<uint32_t, uint64_t>, uint32_t, uint64_t>,
   std::tuple<HashMapTslSparse<uint32_t, uint64_t>, uint32_t, uint64_t>,
+  std::tuple<ShardedHashMap<HashMapRobinHoodFlat, uint32_t, uint64_t>, uint32_t, uint64_t>,
+  std::tuple<ShardedHashMap<HashMapTslRobin, uint32_t, uint64_t>, uint32_t, uint64_t>,
   // Following test fails: Both template parameters must be the same size as a void*
   // std::tuple<Judy<uint32_t, uint64_t>, uint32_t, uint64_t>,
+  std::tuple<Masstree<uint32_t, uint64_t>, uint32_t, uint64_t>,
+  std::tuple<PiecewiseLinearIndex<uint32_t, uint64_t>, uint32_t, uint64_t>,
+  std::tuple<SimdSortedVector<uint32_t, uint64_t>, uint32_t, uint64_t>,
   std::tuple<SimpleVector<uint32_t, uint64_t>, uint32_t, uint64_t>,
   std::tuple<SkipList<uint32_t, uint64_t>, uint32_t, uint64_t>,
   std::tuple<SortedVector<uint32_t, uint64_t>, uint32_t, uint64_t>,
@@ -60,15 +112,29 @@ using CompetitorTestingTypes = ::testing::Types<
   // !!! using TID = uint64_t; is defined in N.h of the ARTSynchronized library. Setting it to
   // TID = uint32_t; allows experiments with the below test
   // std::tuple<Art<uint64_t, uint32_t>, uint64_t, uint32_t>,
+  // std::tuple<ArtOlc<uint64_t, uint32_t>, uint64_t, uint32_t>,
   std::tuple<BbTree<uint64_t, uint32_t>, uint64_t, uint32_t>,
   std::tuple<BTreeGoogleAbseil<uint64_t, uint32_t>, uint64_t, uint32_t>,
+  std::tuple<BTreeGoogleAbseilMultimap<uint64_t, uint32_t>, uint64_t, uint32_t>,
   std::tuple<BTreeTlx<uint64_t, uint32_t>, uint64_t, uint32_t>,
+  std::tuple<BTreeTlxMultimap<uint64_t, uint32_t>, uint64_t, uint32_t>,
+  std::tuple<BTreeTlxPartitioned<uint64_t, uint32_t>, uint64_t, uint32_t>,
+  std::tuple<BwTreeIndex<uint64_t, uint32_t>, uint64_t, uint32_t>,
+  std::tuple<ColumnarSortedVector<uint64_t, uint32_t>, uint64_t, uint32_t>,
+  std::tuple<Cssl<uint64_t, uint32_t>, uint64_t, uint32_t>,
+  std::tuple<EytzingerArray<uint64_t, uint32_t>, uint64_t, uint32_t>,
   std::tuple<HashMapRobinHoodFlat<uint64_t, uint32_t>, uint64_t, uint32_t>,
   std::tuple<HashMapRobinHoodNode<uint64_t, uint32_t>, uint64_t, uint32_t>,
+  std::tuple<HashMapRobinHoodPostingList<uint64_t, uint32_t>, uint64_t, uint32_t>,
   std::tuple<HashMapTslRobin<uint64_t, uint32_t>, uint64_t, uint32_t>,
   std::tuple<HashMapTslSparse<uint64_t, uint32_t>, uint64_t, uint32_t>,
+  std::tuple<ShardedHashMap<HashMapRobinHoodFlat, uint64_t, uint32_t>, uint64_t, uint32_t>,
+  std::tuple<ShardedHashMap<HashMapTslRobin, uint64_t, uint32_t>, uint64_t, uint32_t>,
   // Following test fails: Both template parameters must be the same size as a void*
   // std::tuple<Judy<uint64_t, uint32_t>, uint64_t, uint32_t>,
+  std::tuple<Masstree<uint64_t, uint32_t>, uint64_t, uint32_t>,
+  std::tuple<PiecewiseLinearIndex<uint64_t, uint32_t>, uint64_t, uint32_t>,
+  std::tuple<SimdSortedVector<uint64_t, uint32_t>, uint64_t, uint32_t>,
   std::tuple<SimpleVector<uint64_t, uint32_t>, uint64_t, uint32_t>,
   std::tuple<SkipList<uint64_t, uint32_t>, uint64_t, uint32_t>,
   std::tuple<SortedVector<uint64_t, uint32_t>, uint64_t, uint32_t>,
@@ -77,15 +143,29 @@ using CompetitorTestingTypes = ::testing::Types<
   // !!! using TID = uint64_t; is defined in N.h of the ARTSynchronized library. Setting it to
   // TID = uint32_t; allows experiments with the below test
   // std::tuple<Art<uint32_t, uint32_t>, uint32_t, uint32_t>,
+  // std::tuple<ArtOlc<uint32_t, uint32_t>, uint32_t, uint32_t>,
   std::tuple<BbTree<uint32_t, uint32_t>, uint32_t, uint32_t>,
   std::tuple<BTreeGoogleAbseil<uint32_t, uint32_t>, uint32_t, uint32_t>,
+  std::tuple<BTreeGoogleAbseilMultimap<uint32_t, uint32_t>, uint32_t, uint32_t>,
   std::tuple<BTreeTlx<uint32_t, uint32_t>, uint32_t, uint32_t>,
+  std::tuple<BTreeTlxMultimap<uint32_t, uint32_t>, uint32_t, uint32_t>,
+  std::tuple<BTreeTlxPartitioned<uint32_t, uint32_t>, uint32_t, uint32_t>,
+  std::tuple<BwTreeIndex<uint32_t, uint32_t>, uint32_t, uint32_t>,
+  std::tuple<ColumnarSortedVector<uint32_t, uint32_t>, uint32_t, uint32_t>,
+  std::tuple<Cssl<uint32_t, uint32_t>, uint32_t, uint32_t>,
+  std::tuple<EytzingerArray<uint32_t, uint32_t>, uint32_t, uint32_t>,
   std::tuple<HashMapRobinHoodFlat<uint32_t, uint32_t>, uint32_t, uint32_t>,
   std::tuple<HashMapRobinHoodNode<uint32_t, uint32_t>, uint32_t, uint32_t>,
+  std::tuple<HashMapRobinHoodPostingList<uint32_t, uint32_t>, uint32_t, uint32_t>,
   std::tuple<HashMapTslRobin<uint32_t, uint32_t>, uint32_t, uint32_t>,
   std::tuple<HashMapTslSparse<uint32_t, uint32_t>, uint32_t, uint32_t>,
+  std::tuple<ShardedHashMap<HashMapRobinHoodFlat, uint32_t, uint32_t>, uint32_t, uint32_t>,
+  std::tuple<ShardedHashMap<HashMapTslRobin, uint32_t, uint32_t>, uint32_t, uint32_t>,
   // Following test fails: Both template parameters must be the same size as a void*
   // std::tuple<Judy<uint32_t, uint32_t>, uint32_t, uint32_t>,
+  std::tuple<Masstree<uint32_t, uint32_t>, uint32_t, uint32_t>,
+  std::tuple<PiecewiseLinearIndex<uint32_t, uint32_t>, uint32_t, uint32_t>,
+  std::tuple<SimdSortedVector<uint32_t, uint32_t>, uint32_t, uint32_t>,
   std::tuple<SimpleVector<uint32_t, uint32_t>, uint32_t, uint32_t>,
   std::tuple<SkipList<uint32_t, uint32_t>, uint32_t, uint32_t>,
   std::tuple<SortedVector<uint32_t, uint32_t>, uint32_t, uint32_t>,
@@ -100,7 +180,7 @@ class CompetitorUniqueKeysTest : public ::testing::Test {
   using Value = typename std::tuple_element<2, T>::type;
 
  protected:
-  void SetUp() override { Column<Key, Value>::fill(_sorted_data.entries); }
+  void SetUp() override { Column<Key, Value>::fill(_sorted_data.entries()); }
 
   void TearDown() override {
     // do nothing
@@ -115,8 +195,7 @@ class CompetitorUniqueKeysTest : public ::testing::Test {
       std::vector<std::pair<Key, Value>>{{11, 26}, {12, 29}, {14, 12}, {16, 15}, {17, 21}, {18, 3},  {21, 9},
                                          {22, 25}, {24, 19}, {25, 2},  {28, 23}, {30, 4},  {31, 17}, {33, 6},
                                          {34, 16}, {36, 1},  {37, 7},  {38, 20}, {42, 27}, {43, 28}},
-      std::vector<std::vector<float>>{{11}, {12}, {14}, {16}, {17}, {18}, {21}, {22}, {24}, {25},
-                                      {28}, {30}, {31}, {33}, {34}, {36}, {37}, {38}, {42}, {43}}};
+      std::vector<float>{11, 12, 14, 16, 17, 18, 21, 22, 24, 25, 28, 30, 31, 33, 34, 36, 37, 38, 42, 43}};
 };
 
 TYPED_TEST_SUITE(CompetitorUniqueKeysTest, CompetitorTestingTypes);
@@ -154,9 +233,9 @@ TYPED_TEST(CompetitorUniqueKeysTest, SupportBulkErase) {
 TYPED_TEST(CompetitorUniqueKeysTest, SupportInsertEntry) {
   using Index = typename std::tuple_element<0, TypeParam>::type;
   if (Index::supports(IndexOperationType::InsertEntry)) {
-    EXPECT_NO_THROW(this->_index.insert(this->_sorted_data.entries[0].first, this->_sorted_data.entries[0].second));
+    EXPECT_NO_THROW(this->_index.insert(this->_sorted_data.entries()[0].first, this->_sorted_data.entries()[0].second));
   } else {
-    EXPECT_THROW(this->_index.insert(this->_sorted_data.entries[0].first, this->_sorted_data.entries[0].second),
+    EXPECT_THROW(this->_index.insert(this->_sorted_data.entries()[0].first, this->_sorted_data.entries()[0].second),
                  std::logic_error);
   }
 }
@@ -164,9 +243,9 @@ TYPED_TEST(CompetitorUniqueKeysTest, SupportInsertEntry) {
 TYPED_TEST(CompetitorUniqueKeysTest, SupportEraseEntry) {
   using Index = typename std::tuple_element<0, TypeParam>::type;
   if (Index::supports(IndexOperationType::EraseEntry)) {
-    EXPECT_NO_THROW(this->_index.erase(this->_sorted_data.entries[0].first, this->_sorted_data.entries[0].second));
+    EXPECT_NO_THROW(this->_index.erase(this->_sorted_data.entries()[0].first, this->_sorted_data.entries()[0].second));
   } else {
-    EXPECT_THROW(this->_index.erase(this->_sorted_data.entries[0].first, this->_sorted_data.entries[0].second),
+    EXPECT_THROW(this->_index.erase(this->_sorted_data.entries()[0].first, this->_sorted_data.entries()[0].second),
                  std::logic_error);
   }
 }
@@ -174,9 +253,9 @@ TYPED_TEST(CompetitorUniqueKeysTest, SupportEraseEntry) {
 TYPED_TEST(CompetitorUniqueKeysTest, SupportEqualityLookup) {
   using Index = typename std::tuple_element<0, TypeParam>::type;
   if (Index::supports(IndexOperationType::EqualityLookup)) {
-    EXPECT_NO_THROW(this->_index.equality_lookup(this->_sorted_data.entries[0].first));
+    EXPECT_NO_THROW(this->_index.equality_lookup(this->_sorted_data.entries()[0].first));
   } else {
-    EXPECT_THROW(this->_index.equality_lookup(this->_sorted_data.entries[0].first), std::logic_error);
+    EXPECT_THROW(this->_index.equality_lookup(this->_sorted_data.entries()[0].first), std::logic_error);
   }
 }
 
@@ -184,10 +263,11 @@ TYPED_TEST(CompetitorUniqueKeysTest, SupportRangeLookup) {
   using Index = typename std::tuple_element<0, TypeParam>::type;
   if (Index::supports(IndexOperationType::RangeLookup)) {
     EXPECT_NO_THROW(
-        this->_index.range_lookup(this->_sorted_data.entries[0].first, this->_sorted_data.entries[0].first));
+        this->_index.range_lookup(this->_sorted_data.entries()[0].first, this->_sorted_data.entries()[0].first));
   } else {
-    EXPECT_THROW(this->_index.range_lookup(this->_sorted_data.entries[0].first, this->_sorted_data.entries[0].first),
-                 std::logic_error);
+    EXPECT_THROW(
+        this->_index.range_lookup(this->_sorted_data.entries()[0].first, this->_sorted_data.entries()[0].first),
+        std::logic_error);
   }
 }
 
@@ -200,7 +280,7 @@ TYPED_TEST(CompetitorUniqueKeysTest, BulkLoadOnEmptyIndex) {
   }
 
   this->_index.bulk_load(this->_sorted_data);
-  for (const auto& entry : this->_sorted_data.entries) {
+  for (const auto& entry : this->_sorted_data.entries()) {
     const auto result = this->_index.equality_lookup(entry.first);
     ASSERT_EQ(result.size(), 1u);
     ASSERT_EQ(result[0], entry.second);
@@ -223,7 +303,7 @@ TYPED_TEST(CompetitorUniqueKeysTest, BulkInsert) {
     ASSERT_EQ(result[0], 200);
   }
   this->_index.bulk_insert(this->_sorted_data);
-  for (const auto& entry : this->_sorted_data.entries) {
+  for (const auto& entry : this->_sorted_data.entries()) {
     const auto result = this->_index.equality_lookup(entry.first);
     ASSERT_EQ(result.size(), 1u);
     ASSERT_EQ(result[0], entry.second);
@@ -244,7 +324,7 @@ TYPED_TEST(CompetitorUniqueKeysTest, BulkLoad) {
   }
 
   this->_index.bulk_load(this->_sorted_data);
-  for (const auto& entry : this->_sorted_data.entries) {
+  for (const auto& entry : this->_sorted_data.entries()) {
     const auto result = this->_index.equality_lookup(entry.first);
     ASSERT_EQ(result.size(), 1u);
     ASSERT_EQ(result[0], entry.second);
@@ -260,12 +340,12 @@ TYPED_TEST(CompetitorUniqueKeysTest, BulkErase) {
   }
 
   // store all entries
-  for (const auto& entry : this->_sorted_data.entries) {
+  for (const auto& entry : this->_sorted_data.entries()) {
     this->_index.insert(entry.first, entry.second);
   }
 
   // check if all entries are stored
-  for (const auto& entry : this->_sorted_data.entries) {
+  for (const auto& entry : this->_sorted_data.entries()) {
     const auto result = this->_index.equality_lookup(entry.first);
     ASSERT_EQ(result.size(), 1u);
     EXPECT_EQ(result[0], entry.second);
@@ -273,16 +353,49 @@ TYPED_TEST(CompetitorUniqueKeysTest, BulkErase) {
 
   this->_index.bulk_erase(this->_sorted_data);
   // check if all entries are deleted
-  for (const auto& entry : this->_sorted_data.entries) {
+  for (const auto& entry : this->_sorted_data.entries()) {
     const auto result = this->_index.equality_lookup(entry.first);
     ASSERT_EQ(result.size(), 0u);
   }
 }
 
+// erase a key range and single entries with one bulk erase, the other entries remain stored
+TYPED_TEST(CompetitorUniqueKeysTest, BulkErasePartOfEntries) {
+  using Index = typename std::tuple_element<0, TypeParam>::type;
+  using Key = typename std::tuple_element<1, TypeParam>::type;
+  using Value = typename std::tuple_element<2, TypeParam>::type;
+  if (!Index::supports(IndexOperationType::BulkErase)) {
+    return;
+  }
+
+  const auto& entries = this->_sorted_data.entries();
+  for (const auto& entry : entries) {
+    this->_index.insert(entry.first, entry.second);
+  }
+  // the first five entries, two single entries, and a key that is not stored, in random order
+  auto erased_entries = std::vector<std::pair<Key, Value>>{entries[12], entries[3], {13, 30}, entries[0], entries[4],
+                                                           entries[2], entries[1], entries[19]};
+  const auto erased_data = Data<Key, Value>{{}, {}, erased_entries, {}};
+  this->_index.bulk_erase(erased_data);
+  erased_entries.emplace_back(entries[7]);
+  this->_index.bulk_erase(Data<Key, Value>{{}, {}, {entries[7]}, {}});
+
+  for (const auto& entry : entries) {
+    const auto erased = std::find(erased_entries.cbegin(), erased_entries.cend(), entry) != erased_entries.cend();
+    const auto result = this->_index.equality_lookup(entry.first);
+    if (erased) {
+      EXPECT_TRUE(result.empty()) << entry.first;
+    } else {
+      ASSERT_EQ(result.size(), 1u) << entry.first;
+      EXPECT_EQ(result[0], entry.second);
+    }
+  }
+}
+
 // insert one entry using the single insert function
 TYPED_TEST(CompetitorUniqueKeysTest, SingleInsertOneEntry) {
-  const auto& stored_entry = this->_sorted_data.entries[0];
-  const auto& missing_entry = this->_sorted_data.entries[1];
+  const auto& stored_entry = this->_sorted_data.entries()[0];
+  const auto& missing_entry = this->_sorted_data.entries()[1];
 
   // no value is stored yet
   const auto result_before_insert = this->_index.equality_lookup(stored_entry.first);
@@ -322,13 +435,13 @@ TYPED_TEST(CompetitorUniqueKeysTest, SingleInsertOneEntry) {
 // insert multiple entries using the single insert function
 TYPED_TEST(CompetitorUniqueKeysTest, SingleInsertMultipleEntries) {
   // initially, no entry is stored
-  for (const auto& entry : this->_sorted_data.entries) {
+  for (const auto& entry : this->_sorted_data.entries()) {
     const auto result = this->_index.equality_lookup(entry.first);
     EXPECT_TRUE(result.empty());
   }
 
   // store all entries
-  for (const auto& entry : this->_sorted_data.entries) {
+  for (const auto& entry : this->_sorted_data.entries()) {
     this->_index.insert(entry.first, entry.second);
     const auto result = this->_index.equality_lookup(entry.first);
     ASSERT_EQ(result.size(), 1u);
@@ -336,7 +449,7 @@ TYPED_TEST(CompetitorUniqueKeysTest, SingleInsertMultipleEntries) {
   }
 
   // check if all entries are stored
-  for (const auto& entry : this->_sorted_data.entries) {
+  for (const auto& entry : this->_sorted_data.entries()) {
     const auto result = this->_index.equality_lookup(entry.first);
     ASSERT_EQ(result.size(), 1u);
     EXPECT_EQ(result[0], entry.second);
@@ -348,7 +461,7 @@ TYPED_TEST(CompetitorUniqueKeysTest, SingleInsertMultipleEntries) {
 
 // erase one entry using the single erase function
 TYPED_TEST(CompetitorUniqueKeysTest, SingleEraseOneEntry) {
-  const auto& entry = this->_sorted_data.entries[0];
+  const auto& entry = this->_sorted_data.entries()[0];
 
   const auto result_before_insert = this->_index.equality_lookup(entry.first);
   EXPECT_TRUE(result_before_insert.empty());
@@ -369,7 +482,7 @@ TYPED_TEST(CompetitorUniqueKeysTest, SingleEraseOneEntry) {
 
 // erase multiple entries using the single erase function
 TYPED_TEST(CompetitorUniqueKeysTest, SingleEraseMultipleEntries) {
-  const auto& entries = this->_sorted_data.entries;
+  const auto& entries = this->_sorted_data.entries();
 
   // store all entries
   for (const auto& entry : entries) {
@@ -408,7 +521,7 @@ TYPED_TEST(CompetitorUniqueKeysTest, SingleEraseMultipleEntries) {
 
 TYPED_TEST(CompetitorUniqueKeysTest, RangeLookupIncludingFirstEntry) {
   // store all entries
-  for (const auto& entry : this->_sorted_data.entries) {
+  for (const auto& entry : this->_sorted_data.entries()) {
     this->_index.insert(entry.first, entry.second);
   }
 
@@ -424,13 +537,13 @@ TYPED_TEST(CompetitorUniqueKeysTest, RangeLookupIncludingFirstEntry) {
   const auto result = this->_index.range_lookup(range.first, range.second);
   ASSERT_EQ(result.size(), 10u);
   for (auto idx = 0u; idx < result.size(); ++idx) {
-    ASSERT_EQ(result[idx], this->_sorted_data.entries[idx].second);
+    ASSERT_EQ(result[idx], this->_sorted_data.entries()[idx].second);
   }
 }
 
 TYPED_TEST(CompetitorUniqueKeysTest, RangeLookupIncludingLastEntry) {
   // store all entries
-  for (const auto& entry : this->_sorted_data.entries) {
+  for (const auto& entry : this->_sorted_data.entries()) {
     this->_index.insert(entry.first, entry.second);
   }
 
@@ -446,13 +559,13 @@ TYPED_TEST(CompetitorUniqueKeysTest, RangeLookupIncludingLastEntry) {
   ASSERT_EQ(result.size(), 10u);
   const auto entry_start_index = 10;
   for (auto idx = 0u; idx < result.size(); ++idx) {
-    ASSERT_EQ(result[idx], this->_sorted_data.entries[entry_start_index + idx].second);
+    ASSERT_EQ(result[idx], this->_sorted_data.entries()[entry_start_index + idx].second);
   }
 }
 
 TYPED_TEST(CompetitorUniqueKeysTest, RangeLookupWithoutFirstAndLastEntries) {
   // store all entries
-  for (const auto& entry : this->_sorted_data.entries) {
+  for (const auto& entry : this->_sorted_data.entries()) {
     this->_index.insert(entry.first, entry.second);
   }
 
@@ -469,17 +582,17 @@ TYPED_TEST(CompetitorUniqueKeysTest, RangeLookupWithoutFirstAndLastEntries) {
   ASSERT_EQ(result.size(), 5u);
   const auto entry_start_index = 10;
   for (auto idx = 0u; idx < result.size(); ++idx) {
-    ASSERT_EQ(result[idx], this->_sorted_data.entries[entry_start_index + idx].second);
+    ASSERT_EQ(result[idx], this->_sorted_data.entries()[entry_start_index + idx].second);
   }
 }
 
 TYPED_TEST(CompetitorUniqueKeysTest, RangeLookupIsEqualityLookup) {
   // store all entries
-  for (const auto& entry : this->_sorted_data.entries) {
+  for (const auto& entry : this->_sorted_data.entries()) {
     this->_index.insert(entry.first, entry.second);
   }
 
-  const auto entry_to_lookup = this->_sorted_data.entries[9];
+  const auto entry_to_lookup = this->_sorted_data.entries()[9];
 
   using Index = typename std::tuple_element<0, TypeParam>::type;
   if (!Index::supports(IndexOperationType::RangeLookup)) {
@@ -492,4 +605,305 @@ TYPED_TEST(CompetitorUniqueKeysTest, RangeLookupIsEqualityLookup) {
   ASSERT_EQ(result[0], entry_to_lookup.second);
 }
 
+// the lookup overloads with a result buffer append to the buffer instead of replacing its content
+TYPED_TEST(CompetitorUniqueKeysTest, LookupsAppendToResult) {
+  // store all entries
+  for (const auto& entry : this->_sorted_data.entries()) {
+    this->_index.insert(entry.first, entry.second);
+  }
+
+  using Value = typename std::tuple_element<2, TypeParam>::type;
+  const auto& entries = this->_sorted_data.entries();
+  auto result = std::vector<Value>{};
+  this->_index.equality_lookup(entries[9].first, result);
+  this->_index.equality_lookup(entries[10].first, result);
+  ASSERT_EQ(result.size(), 2u);
+  EXPECT_EQ(result[0], entries[9].second);
+  EXPECT_EQ(result[1], entries[10].second);
+
+  using Index = typename std::tuple_element<0, TypeParam>::type;
+  if (!Index::supports(IndexOperationType::RangeLookup)) {
+    EXPECT_THROW(this->_index.range_lookup(entries[10].first, entries[14].first, result), std::logic_error);
+    return;
+  }
+
+  this->_index.range_lookup(entries[10].first, entries[14].first, result);
+  ASSERT_EQ(result.size(), 7u);
+  for (auto idx = 2u; idx < result.size(); ++idx) {
+    EXPECT_EQ(result[idx], entries[idx + 8].second);
+  }
+}
+
+// stores multiple values per key, e.g., a non-unique secondary index, and erases single values of a key
+TYPED_TEST(CompetitorUniqueKeysTest, KeyDuplicates) {
+  using Index = typename std::tuple_element<0, TypeParam>::type;
+  if (!Index::supports_key_duplicates()) {
+    return;
+  }
+  using Key = typename std::tuple_element<1, TypeParam>::type;
+  using Value = typename std::tuple_element<2, TypeParam>::type;
+  // the values of the keys 12 and 14 are taken from the column, since the ART loads the keys by their values
+  const auto& entries = this->_sorted_data.entries();
+  const auto duplicate_key = entries[1].first;
+  const auto other_key = entries[2].first;
+  // the values are inserted in ascending order, thus, the insertion order is also the order of the sorted competitors
+  const auto duplicate_values = std::vector<Value>{5, 8, 10, 11, entries[1].second};
+  for (const auto value : duplicate_values) {
+    Column<Key, Value>::value_at(value) = duplicate_key;
+    this->_index.insert(duplicate_key, value);
+  }
+  this->_index.insert(other_key, entries[2].second);
+
+  EXPECT_EQ(this->_index.equality_lookup(duplicate_key), duplicate_values);
+  EXPECT_EQ(this->_index.equality_lookup(other_key), (std::vector<Value>{entries[2].second}));
+  if (Index::supports(IndexOperationType::RangeLookup)) {
+    EXPECT_EQ(this->_index.range_lookup(duplicate_key, other_key).size(), duplicate_values.size() + 1);
+  }
+
+  // erase the first, a middle, and the last value of the key
+  this->_index.erase(duplicate_key, duplicate_values[0]);
+  this->_index.erase(duplicate_key, duplicate_values[2]);
+  this->_index.erase(duplicate_key, duplicate_values[4]);
+  EXPECT_EQ(this->_index.equality_lookup(duplicate_key),
+            (std::vector<Value>{duplicate_values[1], duplicate_values[3]}));
+  // the last value is appended after the remaining values
+  this->_index.insert(duplicate_key, duplicate_values[4]);
+  EXPECT_EQ(this->_index.equality_lookup(duplicate_key),
+            (std::vector<Value>{duplicate_values[1], duplicate_values[3], duplicate_values[4]}));
+  for (const auto value : duplicate_values) {
+    this->_index.erase(duplicate_key, value);
+  }
+  EXPECT_TRUE(this->_index.equality_lookup(duplicate_key).empty());
+  EXPECT_EQ(this->_index.equality_lookup(other_key), (std::vector<Value>{entries[2].second}));
+}
+
+// compares the batch lookup, which is only provided by some competitors, with single equality lookups
+TYPED_TEST(CompetitorUniqueKeysTest, EqualityLookupBatch) {
+  using Index = typename std::tuple_element<0, TypeParam>::type;
+  using Key = typename std::tuple_element<1, TypeParam>::type;
+  using Value = typename std::tuple_element<2, TypeParam>::type;
+  if constexpr (requires(const Index& index, std::span<const Key> keys, std::vector<Value>& result) {
+                  index.equality_lookup_batch(keys, result);
+                }) {
+    // lookup keys before, between, and after the stored keys, more keys than one interleaved group
+    auto keys = std::vector<Key>{};
+    for (Key key = 0; key < 50; key += 3) {
+      keys.push_back(key);
+    }
+    keys.insert(keys.end(), this->_sorted_data.keys().crbegin(), this->_sorted_data.keys().crend());
+
+    auto result = std::vector<Value>{};
+    this->_index.equality_lookup_batch(keys, result);
+    EXPECT_TRUE(result.empty());
+
+    for (const auto& entry : this->_sorted_data.entries()) {
+      this->_index.insert(entry.first, entry.second);
+    }
+    this->_index.equality_lookup_batch(keys, result);
+    auto expected_result = std::vector<Value>{};
+    for (const auto& key : keys) {
+      this->_index.equality_lookup(key, expected_result);
+    }
+    EXPECT_EQ(result, expected_result);
+  }
+}
+
+// clang-format off
+using CompetitorStringTestingTypes = ::testing::Types<
+  std::tuple<Art<std::string_view, uint64_t>, std::string_view, uint64_t>,
+  std::tuple<ArtOlc<std::string_view, uint64_t>, std::string_view, uint64_t>,
+  std::tuple<ArtPostingList<std::string_view, uint64_t>, std::string_view, uint64_t>,
+  std::tuple<BTreeGoogleAbseil<std::string_view, uint64_t>, std::string_view, uint64_t>,
+  std::tuple<BTreeGoogleAbseilMultimap<std::string_view, uint64_t>, std::string_view, uint64_t>,
+  std::tuple<BTreeTlx<std::string_view, uint64_t>, std::string_view, uint64_t>,
+  std::tuple<BTreeTlxMultimap<std::string_view, uint64_t>, std::string_view, uint64_t>,
+  std::tuple<BTreeTlxPartitioned<std::string_view, uint64_t>, std::string_view, uint64_t>,
+  std::tuple<HashMapRobinHoodFlat<std::string_view, uint64_t>, std::string_view, uint64_t>,
+  std::tuple<HashMapRobinHoodNode<std::string_view, uint64_t>, std::string_view, uint64_t>,
+  std::tuple<HashMapRobinHoodPostingList<std::string_view, uint64_t>, std::string_view, uint64_t>,
+  std::tuple<HashMapTslRobin<std::string_view, uint64_t>, std::string_view, uint64_t>,
+  std::tuple<HashMapTslSparse<std::string_view, uint64_t>, std::string_view, uint64_t>,
+  std::tuple<SimpleVector<std::string_view, uint64_t>, std::string_view, uint64_t>,
+  std::tuple<SortedVector<std::string_view, uint64_t>, std::string_view, uint64_t>,
+  std::tuple<UnorderedMap<std::string_view, uint64_t>, std::string_view, uint64_t>
+>;
+// clang-format on
+
+// The string keys are views of the strings of the test, like the string keys of the data are views of its file or
+// arena. The keys share prefixes, are prefixes of each other, and one key is longer than the stack buffer of the ART
+// key.
+template <typename T>
+class CompetitorStringKeysTest : public ::testing::Test {
+  using Key = typename std::tuple_element<1, T>::type;
+  using Value = typename std::tuple_element<2, T>::type;
+
+ protected:
+  void SetUp() override { Column<Key, Value>::fill(_entries); }
+
+  typename std::tuple_element<0, T>::type _index;
+  const std::string _long_key = "user" + std::string(200, 'x');
+  const std::vector<std::pair<Key, Value>> _entries{
+      {"user12", 1}, {"user1", 2}, {"alice@example.com", 3}, {_long_key, 4}, {"user2", 5}, {"a", 6}};
+};
+
+TYPED_TEST_SUITE(CompetitorStringKeysTest, CompetitorStringTestingTypes);
+
+TYPED_TEST(CompetitorStringKeysTest, InsertLookupErase) {
+  using Index = typename std::tuple_element<0, TypeParam>::type;
+  using Value = typename std::tuple_element<2, TypeParam>::type;
+  for (const auto& entry : this->_entries) {
+    this->_index.insert(entry.first, entry.second);
+  }
+  for (const auto& entry : this->_entries) {
+    EXPECT_EQ(this->_index.equality_lookup(entry.first), std::vector<Value>{entry.second}) << entry.first;
+  }
+  // the lookup keys are copies of the stored keys or prefixes of them
+  const auto copied_key = std::string{"user12"};
+  EXPECT_EQ(this->_index.equality_lookup(copied_key), std::vector<Value>{1});
+  EXPECT_TRUE(this->_index.equality_lookup("user").empty());
+  EXPECT_TRUE(this->_index.equality_lookup("user123").empty());
+  EXPECT_TRUE(this->_index.equality_lookup("").empty());
+
+  if (Index::supports(IndexOperationType::RangeLookup)) {
+    // the keys are ordered lexicographically, thus, "user12" is between "user1" and "user2"
+    auto result = this->_index.range_lookup("user1", "user2");
+    std::sort(result.begin(), result.end());
+    EXPECT_EQ(result, (std::vector<Value>{1, 2, 5}));
+  }
+
+  this->_index.erase("user1", 2);
+  EXPECT_TRUE(this->_index.equality_lookup("user1").empty());
+  EXPECT_EQ(this->_index.equality_lookup("user12"), std::vector<Value>{1});
+  EXPECT_EQ(this->_index.equality_lookup(this->_long_key), std::vector<Value>{4});
+}
+
+// The typed tests bulk load too few entries for more than one partition, thus, these tests inject the partition count.
+class BTreeTlxPartitionedTest : public ::testing::Test {
+ protected:
+  static std::vector<uint64_t> _values(const std::vector<std::pair<uint64_t, uint64_t>>& entries) {
+    auto values = std::vector<uint64_t>{};
+    for (const auto& entry : entries) {
+      values.push_back(entry.second);
+    }
+    return values;
+  }
+
+  const Data<uint64_t, uint64_t> _sorted_data{
+      std::vector<uint64_t>{11, 12, 14, 16, 17, 18, 21, 22, 24, 25, 28, 30, 31, 33, 34, 36, 37, 38, 42, 43},
+      std::vector<uint64_t>{26, 29, 12, 15, 21, 3, 9, 25, 19, 2, 23, 4, 17, 6, 16, 1, 7, 20, 27, 28},
+      std::vector<std::pair<uint64_t, uint64_t>>{{11, 26}, {12, 29}, {14, 12}, {16, 15}, {17, 21}, {18, 3},  {21, 9},
+                                                 {22, 25}, {24, 19}, {25, 2},  {28, 23}, {30, 4},  {31, 17}, {33, 6},
+                                                 {34, 16}, {36, 1},  {37, 7},  {38, 20}, {42, 27}, {43, 28}},
+      std::vector<float>{11, 12, 14, 16, 17, 18, 21, 22, 24, 25, 28, 30, 31, 33, 34, 36, 37, 38, 42, 43}};
+};
+
+TEST_F(BTreeTlxPartitionedTest, BulkLoadDefaultPartitionCount) {
+  // the few entries are not worth a second thread, thus, they are bulk loaded into one tree
+  auto index = BTreeTlxPartitioned<uint64_t, uint64_t>{};
+  index.bulk_load(_sorted_data);
+  EXPECT_EQ(index.partition_count(), 1);
+  EXPECT_EQ(index.range_lookup(0, 100), _values(_sorted_data.entries()));
+}
+
+TEST_F(BTreeTlxPartitionedTest, BulkLoadInjectedPartitionCount) {
+  for (const auto partition_count : {size_t{1}, size_t{3}, size_t{4}, size_t{20}, size_t{32}}) {
+    auto index = BTreeTlxPartitioned<uint64_t, uint64_t>{partition_count};
+    index.bulk_load(_sorted_data);
+    // each partition holds at least one entry
+    EXPECT_EQ(index.partition_count(), std::min(partition_count, _sorted_data.entries().size()));
+    for (const auto& entry : _sorted_data.entries()) {
+      EXPECT_EQ(index.equality_lookup(entry.first), std::vector<uint64_t>{entry.second}) << partition_count;
+    }
+    for (const auto missing_key : {uint64_t{0}, uint64_t{13}, uint64_t{35}, uint64_t{44}}) {
+      EXPECT_TRUE(index.equality_lookup(missing_key).empty()) << partition_count;
+    }
+    EXPECT_EQ(index.range_lookup(0, 100), _values(_sorted_data.entries())) << partition_count;
+  }
+}
+
+TEST_F(BTreeTlxPartitionedTest, RangeLookupAcrossPartitions) {
+  // the partitions start at the keys 11, 18, 28, and 36
+  auto index = BTreeTlxPartitioned<uint64_t, uint64_t>{4};
+  index.bulk_load(_sorted_data);
+  ASSERT_EQ(index.partition_count(), 4);
+
+  EXPECT_EQ(index.range_lookup(16, 37), (std::vector<uint64_t>{15, 21, 3, 9, 25, 19, 2, 23, 4, 17, 6, 16, 1, 7}));
+  EXPECT_EQ(index.range_lookup(17, 18), (std::vector<uint64_t>{21, 3}));
+  EXPECT_EQ(index.range_lookup(26, 29), (std::vector<uint64_t>{23}));
+  EXPECT_EQ(index.range_lookup(0, 11), (std::vector<uint64_t>{26}));
+  EXPECT_EQ(index.range_lookup(43, 100), (std::vector<uint64_t>{28}));
+  EXPECT_TRUE(index.range_lookup(26, 27).empty());
+
+  auto result = std::vector<uint64_t>{99};
+  index.range_lookup(34, 36, result);
+  EXPECT_EQ(result, (std::vector<uint64_t>{99, 16, 1}));
+}
+
+TEST_F(BTreeTlxPartitionedTest, InsertAndEraseAcrossPartitions) {
+  auto index = BTreeTlxPartitioned<uint64_t, uint64_t>{4};
+  index.bulk_load(_sorted_data);
+
+  // keys below the first key, between the partitions, and above the last key
+  index.insert(5, 105);
+  index.insert(19, 119);
+  index.insert(27, 127);
+  index.insert(50, 150);
+  EXPECT_EQ(index.equality_lookup(5), std::vector<uint64_t>{105});
+  EXPECT_EQ(index.equality_lookup(19), std::vector<uint64_t>{119});
+  EXPECT_EQ(index.equality_lookup(27), std::vector<uint64_t>{127});
+  EXPECT_EQ(index.equality_lookup(50), std::vector<uint64_t>{150});
+  EXPECT_EQ(index.range_lookup(17, 28), (std::vector<uint64_t>{21, 3, 119, 9, 25, 19, 2, 127, 23}));
+
+  // the first key of a partition still separates the partitions after its entry is erased
+  index.erase(18, 3);
+  index.erase(28, 23);
+  EXPECT_TRUE(index.equality_lookup(18).empty());
+  EXPECT_TRUE(index.equality_lookup(28).empty());
+  EXPECT_EQ(index.range_lookup(17, 30), (std::vector<uint64_t>{21, 119, 9, 25, 19, 2, 127, 4}));
+  index.insert(18, 118);
+  EXPECT_EQ(index.equality_lookup(18), std::vector<uint64_t>{118});
+
+  auto bulk_inserted = Data<uint64_t, uint64_t>{{}, {}, {{1, 101}, {26, 126}, {35, 135}, {60, 160}}, {}};
+  index.bulk_insert(bulk_inserted);
+  for (const auto& entry : bulk_inserted.entries()) {
+    EXPECT_EQ(index.equality_lookup(entry.first), std::vector<uint64_t>{entry.second});
+  }
+  EXPECT_EQ(index.partition_count(), 4);
+}
+
+TEST_F(BTreeTlxPartitionedTest, BulkEraseAcrossPartitions) {
+  const auto& entries = _sorted_data.entries();
+
+  // few erased keys are erased from their partitions one by one
+  auto index = BTreeTlxPartitioned<uint64_t, uint64_t>{4};
+  index.bulk_load(_sorted_data);
+  index.bulk_erase(Data<uint64_t, uint64_t>{{}, {}, {{18, 3}, {38, 20}}, {}});
+  EXPECT_EQ(index.partition_count(), 4);
+  EXPECT_TRUE(index.equality_lookup(18).empty());
+  EXPECT_TRUE(index.equality_lookup(38).empty());
+  EXPECT_EQ(index.range_lookup(17, 21), (std::vector<uint64_t>{21, 9}));
+
+  // many erased keys rebuild the partitions from the remaining entries
+  index = BTreeTlxPartitioned<uint64_t, uint64_t>{4};
+  index.bulk_load(_sorted_data);
+  auto erased_entries = std::vector<std::pair<uint64_t, uint64_t>>{entries.cbegin(), entries.cbegin() + 12};
+  // the keys are erased regardless of their order
+  std::reverse(erased_entries.begin(), erased_entries.end());
+  index.bulk_erase(Data<uint64_t, uint64_t>{{}, {}, erased_entries, {}});
+  EXPECT_EQ(index.partition_count(), 4);
+  for (const auto& entry : erased_entries) {
+    EXPECT_TRUE(index.equality_lookup(entry.first).empty());
+  }
+  const auto remaining_entries = std::vector<std::pair<uint64_t, uint64_t>>{entries.cbegin() + 12, entries.cend()};
+  for (const auto& entry : remaining_entries) {
+    EXPECT_EQ(index.equality_lookup(entry.first), std::vector<uint64_t>{entry.second});
+  }
+  EXPECT_EQ(index.range_lookup(0, 100), _values(remaining_entries));
+
+  // the remaining entries are fewer than the partitions
+  index.bulk_erase(Data<uint64_t, uint64_t>{{}, {}, {entries.cbegin() + 12, entries.cend() - 2}, {}});
+  EXPECT_EQ(index.partition_count(), 2);
+  EXPECT_EQ(index.range_lookup(0, 100), (std::vector<uint64_t>{27, 28}));
+}
+
 }  // namespace imib
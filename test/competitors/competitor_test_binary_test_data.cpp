@@ -6,14 +6,29 @@
 #include "gtest/gtest.h"
 
 #include "competitors/art.hpp"
+#include "competitors/art_olc.hpp"
+#include "competitors/art_posting_list.hpp"
+#include "competitors/art_reference.hpp"
 #include "competitors/b_tree_google_abseil.hpp"
+#include "competitors/b_tree_google_abseil_multimap.hpp"
 #include "competitors/b_tree_tlx.hpp"
+#include "competitors/b_tree_tlx_multimap.hpp"
+#include "competitors/b_tree_tlx_partitioned.hpp"
 #include "competitors/bb_tree.hpp"
+#include "competitors/bw_tree.hpp"
+#include "competitors/columnar_sorted_vector.hpp"
+#include "competitors/cssl.hpp"
+#include "competitors/eytzinger_array.hpp"
 #include "competitors/hash_map_robin_hood_flat.hpp"
 #include "competitors/hash_map_robin_hood_node.hpp"
+#include "competitors/hash_map_robin_hood_posting_list.hpp"
 #include "competitors/hash_map_tsl_robin.hpp"
 #include "competitors/hash_map_tsl_sparse.hpp"
 #include "competitors/judy.hpp"
+#include "competitors/masstree.hpp"
+#include "competitors/piecewise_linear_index.hpp"
+#include "competitors/sharded_hash_map.hpp"
+#include "competitors/simd_sorted_vector.hpp"
 #include "competitors/simple_vector.hpp"
 #include "competitors/skip_list.hpp"
 #include "competitors/sorted_vector.hpp"
@@ -21,6 +36,7 @@
 #include "data/column.hpp"
 #include "data/data_generator.hpp"
 #include "data/lookup_generator.hpp"
+#include "execution/parallel_executor.hpp"
 #include "types.hpp"
 
 struct BookFile {
@@ -45,13 +61,29 @@ struct TestData {
 using CompetitorTestingTypes = ::testing::Types<
   // BB-Tree only supports uint32_t values
   std::tuple<Art<uint64_t, uint64_t>, uint64_t, uint64_t, BookFile>,
+  std::tuple<ArtOlc<uint64_t, uint64_t>, uint64_t, uint64_t, BookFile>,
+  std::tuple<ArtPostingList<uint64_t, uint64_t>, uint64_t, uint64_t, BookFile>,
+  std::tuple<ArtReference<uint64_t, uint64_t>, uint64_t, uint64_t, BookFile>,
   std::tuple<BTreeGoogleAbseil<uint64_t, uint64_t>, uint64_t, uint64_t, BookFile>,
+  std::tuple<BTreeGoogleAbseilMultimap<uint64_t, uint64_t>, uint64_t, uint64_t, BookFile>,
   std::tuple<BTreeTlx<uint64_t, uint64_t>, uint64_t, uint64_t, BookFile>,
+  std::tuple<BTreeTlxMultimap<uint64_t, uint64_t>, uint64_t, uint64_t, BookFile>,
+  std::tuple<BTreeTlxPartitioned<uint64_t, uint64_t>, uint64_t, uint64_t, BookFile>,
+  std::tuple<BwTreeIndex<uint64_t, uint64_t>, uint64_t, uint64_t, BookFile>,
+  std::tuple<ColumnarSortedVector<uint64_t, uint64_t>, uint64_t, uint64_t, BookFile>,
+  std::tuple<Cssl<uint64_t, uint64_t>, uint64_t, uint64_t, BookFile>,
+  std::tuple<EytzingerArray<uint64_t, uint64_t>, uint64_t, uint64_t, BookFile>,
   std::tuple<HashMapRobinHoodFlat<uint64_t, uint64_t>, uint64_t, uint64_t, BookFile>,
   std::tuple<HashMapRobinHoodNode<uint64_t, uint64_t>, uint64_t, uint64_t, BookFile>,
+  std::tuple<HashMapRobinHoodPostingList<uint64_t, uint64_t>, uint64_t, uint64_t, BookFile>,
   std::tuple<HashMapTslRobin<uint64_t, uint64_t>, uint64_t, uint64_t, BookFile>,
   std::tuple<HashMapTslSparse<uint64_t, uint64_t>, uint64_t, uint64_t, BookFile>,
+  std::tuple<ShardedHashMap<HashMapRobinHoodFlat, uint64_t, uint64_t>, uint64_t, uint64_t, BookFile>,
+  std::tuple<ShardedHashMap<HashMapTslRobin, uint64_t, uint64_t>, uint64_t, uint64_t, BookFile>,
   std::tuple<Judy<uint64_t, uint64_t>, uint64_t, uint64_t, BookFile>,
+  std::tuple<Masstree<uint64_t, uint64_t>, uint64_t, uint64_t, BookFile>,
+  std::tuple<PiecewiseLinearIndex<uint64_t, uint64_t>, uint64_t, uint64_t, BookFile>,
+  std::tuple<SimdSortedVector<uint64_t, uint64_t>, uint64_t, uint64_t, BookFile>,
   std::tuple<SimpleVector<uint64_t, uint64_t>, uint64_t, uint64_t, BookFile>,
   std::tuple<SkipList<uint64_t, uint64_t>, uint64_t, uint64_t, BookFile>,
   std::tuple<SortedVector<uint64_t, uint64_t>, uint64_t, uint64_t, BookFile>,
@@ -60,12 +92,28 @@ using CompetitorTestingTypes = ::testing::Types<
   // BB-Tree only supports uint32_t values
   // Judy Array can only be used when both keys and values are of type uint64_t
   std::tuple<Art<uint32_t, uint64_t>, uint32_t, uint64_t, BookFile>,
+  std::tuple<ArtOlc<uint32_t, uint64_t>, uint32_t, uint64_t, BookFile>,
+  std::tuple<ArtPostingList<uint32_t, uint64_t>, uint32_t, uint64_t, BookFile>,
+  std::tuple<ArtReference<uint32_t, uint64_t>, uint32_t, uint64_t, BookFile>,
   std::tuple<BTreeGoogleAbseil<uint32_t, uint64_t>, uint32_t, uint64_t, BookFile>,
+  std::tuple<BTreeGoogleAbseilMultimap<uint32_t, uint64_t>, uint32_t, uint64_t, BookFile>,
   std::tuple<BTreeTlx<uint32_t, uint64_t>, uint32_t, uint64_t, BookFile>,
+  std::tuple<BTreeTlxMultimap<uint32_t, uint64_t>, uint32_t, uint64_t, BookFile>,
+  std::tuple<BTreeTlxPartitioned<uint32_t, uint64_t>, uint32_t, uint64_t, BookFile>,
+  std::tuple<BwTreeIndex<uint32_t, uint64_t>, uint32_t, uint64_t, BookFile>,
+  std::tuple<ColumnarSortedVector<uint32_t, uint64_t>, uint32_t, uint64_t, BookFile>,
+  std::tuple<Cssl<uint32_t, uint64_t>, uint32_t, uint64_t, BookFile>,
+  std::tuple<EytzingerArray<uint32_t, uint64_t>, uint32_t, uint64_t, BookFile>,
   std::tuple<HashMapRobinHoodFlat<uint32_t, uint64_t>, uint32_t, uint64_t, BookFile>,
   std::tuple<HashMapRobinHoodNode<uint32_t, uint64_t>, uint32_t, uint64_t, BookFile>,
+  std::tuple<HashMapRobinHoodPostingList<uint32_t, uint64_t>, uint32_t, uint64_t, BookFile>,
   std::tuple<HashMapTslRobin<uint32_t, uint64_t>, uint32_t, uint64_t, BookFile>,
   std::tuple<HashMapTslSparse<uint32_t, uint64_t>, uint32_t, uint64_t, BookFile>,
+  std::tuple<ShardedHashMap<HashMapRobinHoodFlat, uint32_t, uint64_t>, uint32_t, uint64_t, BookFile>,
+  std::tuple<ShardedHashMap<HashMapTslRobin, uint32_t, uint64_t>, uint32_t, uint64_t, BookFile>,
+  std::tuple<Masstree<uint32_t, uint64_t>, uint32_t, uint64_t, BookFile>,
+  std::tuple<PiecewiseLinearIndex<uint32_t, uint64_t>, uint32_t, uint64_t, BookFile>,
+  std::tuple<SimdSortedVector<uint32_t, uint64_t>, uint32_t, uint64_t, BookFile>,
   std::tuple<SimpleVector<uint32_t, uint64_t>, uint32_t, uint64_t, BookFile>,
   std::tuple<SkipList<uint32_t, uint64_t>, uint32_t, uint64_t, BookFile>,
   std::tuple<SortedVector<uint32_t, uint64_t>, uint32_t, uint64_t, BookFile>,
@@ -76,12 +124,26 @@ using CompetitorTestingTypes = ::testing::Types<
   // !!! using TID = uint64_t; is defined in N.h of the ARTSynchronized library. Setting it to
   // TID = uint32_t; allows experiments with the below test
   // std::tuple<Art<uint64_t, uint32_t>, uint64_t, uint32_t>,
+  // std::tuple<ArtOlc<uint64_t, uint32_t>, uint64_t, uint32_t>,
   std::tuple<BTreeGoogleAbseil<uint64_t, uint32_t>, uint64_t, uint32_t, BookFile>,
+  std::tuple<BTreeGoogleAbseilMultimap<uint64_t, uint32_t>, uint64_t, uint32_t, BookFile>,
   std::tuple<BTreeTlx<uint64_t, uint32_t>, uint64_t, uint32_t, BookFile>,
+  std::tuple<BTreeTlxMultimap<uint64_t, uint32_t>, uint64_t, uint32_t, BookFile>,
+  std::tuple<BTreeTlxPartitioned<uint64_t, uint32_t>, uint64_t, uint32_t, BookFile>,
+  std::tuple<BwTreeIndex<uint64_t, uint32_t>, uint64_t, uint32_t, BookFile>,
+  std::tuple<ColumnarSortedVector<uint64_t, uint32_t>, uint64_t, uint32_t, BookFile>,
+  std::tuple<Cssl<uint64_t, uint32_t>, uint64_t, uint32_t, BookFile>,
+  std::tuple<EytzingerArray<uint64_t, uint32_t>, uint64_t, uint32_t, BookFile>,
   std::tuple<HashMapRobinHoodFlat<uint64_t, uint32_t>, uint64_t, uint32_t, BookFile>,
   std::tuple<HashMapRobinHoodNode<uint64_t, uint32_t>, uint64_t, uint32_t, BookFile>,
+  std::tuple<HashMapRobinHoodPostingList<uint64_t, uint32_t>, uint64_t, uint32_t, BookFile>,
   std::tuple<HashMapTslRobin<uint64_t, uint32_t>, uint64_t, uint32_t, BookFile>,
   std::tuple<HashMapTslSparse<uint64_t, uint32_t>, uint64_t, uint32_t, BookFile>,
+  std::tuple<ShardedHashMap<HashMapRobinHoodFlat, uint64_t, uint32_t>, uint64_t, uint32_t, BookFile>,
+  std::tuple<ShardedHashMap<HashMapTslRobin, uint64_t, uint32_t>, uint64_t, uint32_t, BookFile>,
+  std::tuple<Masstree<uint64_t, uint32_t>, uint64_t, uint32_t, BookFile>,
+  std::tuple<PiecewiseLinearIndex<uint64_t, uint32_t>, uint64_t, uint32_t, BookFile>,
+  std::tuple<SimdSortedVector<uint64_t, uint32_t>, uint64_t, uint32_t, BookFile>,
   std::tuple<SimpleVector<uint64_t, uint32_t>, uint64_t, uint32_t, BookFile>,
   std::tuple<SkipList<uint64_t, uint32_t>, uint64_t, uint32_t, BookFile>,
   std::tuple<SortedVector<uint64_t, uint32_t>, uint64_t, uint32_t, BookFile>,
@@ -92,12 +154,26 @@ using CompetitorTestingTypes = ::testing::Types<
   // !!! using TID = uint64_t; is defined in N.h of the ARTSynchronized library. Setting it to
   // TID = uint32_t; allows experiments with the below test
   // std::tuple<Art<uint32_t, uint32_t>, uint32_t, uint32_t>,
+  // std::tuple<ArtOlc<uint32_t, uint32_t>, uint32_t, uint32_t>,
   std::tuple<BTreeGoogleAbseil<uint32_t, uint32_t>, uint32_t, uint32_t, BookFile>,
+  std::tuple<BTreeGoogleAbseilMultimap<uint32_t, uint32_t>, uint32_t, uint32_t, BookFile>,
   std::tuple<BTreeTlx<uint32_t, uint32_t>, uint32_t, uint32_t, BookFile>,
+  std::tuple<BTreeTlxMultimap<uint32_t, uint32_t>, uint32_t, uint32_t, BookFile>,
+  std::tuple<BTreeTlxPartitioned<uint32_t, uint32_t>, uint32_t, uint32_t, BookFile>,
+  std::tuple<BwTreeIndex<uint32_t, uint32_t>, uint32_t, uint32_t, BookFile>,
+  std::tuple<ColumnarSortedVector<uint32_t, uint32_t>, uint32_t, uint32_t, BookFile>,
+  std::tuple<Cssl<uint32_t, uint32_t>, uint32_t, uint32_t, BookFile>,
+  std::tuple<EytzingerArray<uint32_t, uint32_t>, uint32_t, uint32_t, BookFile>,
   std::tuple<HashMapRobinHoodFlat<uint32_t, uint32_t>, uint32_t, uint32_t, BookFile>,
   std::tuple<HashMapRobinHoodNode<uint32_t, uint32_t>, uint32_t, uint32_t, BookFile>,
+  std::tuple<HashMapRobinHoodPostingList<uint32_t, uint32_t>, uint32_t, uint32_t, BookFile>,
   std::tuple<HashMapTslRobin<uint32_t, uint32_t>, uint32_t, uint32_t, BookFile>,
   std::tuple<HashMapTslSparse<uint32_t, uint32_t>, uint32_t, uint32_t, BookFile>,
+  std::tuple<ShardedHashMap<HashMapRobinHoodFlat, uint32_t, uint32_t>, uint32_t, uint32_t, BookFile>,
+  std::tuple<ShardedHashMap<HashMapTslRobin, uint32_t, uint32_t>, uint32_t, uint32_t, BookFile>,
+  std::tuple<Masstree<uint32_t, uint32_t>, uint32_t, uint32_t, BookFile>,
+  std::tuple<PiecewiseLinearIndex<uint32_t, uint32_t>, uint32_t, uint32_t, BookFile>,
+  std::tuple<SimdSortedVector<uint32_t, uint32_t>, uint32_t, uint32_t, BookFile>,
   std::tuple<SimpleVector<uint32_t, uint32_t>, uint32_t, uint32_t, BookFile>,
   std::tuple<SkipList<uint32_t, uint32_t>, uint32_t, uint32_t, BookFile>,
   std::tuple<SortedVector<uint32_t, uint32_t>, uint32_t, uint32_t, BookFile>,
@@ -105,13 +181,29 @@ using CompetitorTestingTypes = ::testing::Types<
 
   // BB-Tree only supports uint32_t values
   std::tuple<Art<uint64_t, uint64_t>, uint64_t, uint64_t, RandomNumbersFile>,
+  std::tuple<ArtOlc<uint64_t, uint64_t>, uint64_t, uint64_t, RandomNumbersFile>,
+  std::tuple<ArtPostingList<uint64_t, uint64_t>, uint64_t, uint64_t, RandomNumbersFile>,
+  std::tuple<ArtReference<uint64_t, uint64_t>, uint64_t, uint64_t, RandomNumbersFile>,
   std::tuple<BTreeGoogleAbseil<uint64_t, uint64_t>, uint64_t, uint64_t, RandomNumbersFile>,
+  std::tuple<BTreeGoogleAbseilMultimap<uint64_t, uint64_t>, uint64_t, uint64_t, RandomNumbersFile>,
   std::tuple<BTreeTlx<uint64_t, uint64_t>, uint64_t, uint64_t, RandomNumbersFile>,
+  std::tuple<BTreeTlxMultimap<uint64_t, uint64_t>, uint64_t, uint64_t, RandomNumbersFile>,
+  std::tuple<BTreeTlxPartitioned<uint64_t, uint64_t>, uint64_t, uint64_t, RandomNumbersFile>,
+  std::tuple<BwTreeIndex<uint64_t, uint64_t>, uint64_t, uint64_t, RandomNumbersFile>,
+  std::tuple<ColumnarSortedVector<uint64_t, uint64_t>, uint64_t, uint64_t, RandomNumbersFile>,
+  std::tuple<Cssl<uint64_t, uint64_t>, uint64_t, uint64_t, RandomNumbersFile>,
+  std::tuple<EytzingerArray<uint64_t, uint64_t>, uint64_t, uint64_t, RandomNumbersFile>,
   std::tuple<HashMapRobinHoodFlat<uint64_t, uint64_t>, uint64_t, uint64_t, RandomNumbersFile>,
   std::tuple<HashMapRobinHoodNode<uint64_t, uint64_t>, uint64_t, uint64_t, RandomNumbersFile>,
+  std::tuple<HashMapRobinHoodPostingList<uint64_t, uint64_t>, uint64_t, uint64_t, RandomNumbersFile>,
   std::tuple<HashMapTslRobin<uint64_t, uint64_t>, uint64_t, uint64_t, RandomNumbersFile>,
   std::tuple<HashMapTslSparse<uint64_t, uint64_t>, uint64_t, uint64_t, RandomNumbersFile>,
+  std::tuple<ShardedHashMap<HashMapRobinHoodFlat, uint64_t, uint64_t>, uint64_t, uint64_t, RandomNumbersFile>,
+  std::tuple<ShardedHashMap<HashMapTslRobin, uint64_t, uint64_t>, uint64_t, uint64_t, RandomNumbersFile>,
   std::tuple<Judy<uint64_t, uint64_t>, uint64_t, uint64_t, RandomNumbersFile>,
+  std::tuple<Masstree<uint64_t, uint64_t>, uint64_t, uint64_t, RandomNumbersFile>,
+  std::tuple<PiecewiseLinearIndex<uint64_t, uint64_t>, uint64_t, uint64_t, RandomNumbersFile>,
+  std::tuple<SimdSortedVector<uint64_t, uint64_t>, uint64_t, uint64_t, RandomNumbersFile>,
   std::tuple<SimpleVector<uint64_t, uint64_t>, uint64_t, uint64_t, RandomNumbersFile>,
   std::tuple<SkipList<uint64_t, uint64_t>, uint64_t, uint64_t, RandomNumbersFile>,
   std::tuple<SortedVector<uint64_t, uint64_t>, uint64_t, uint64_t, RandomNumbersFile>,
@@ -120,12 +212,28 @@ using CompetitorTestingTypes = ::testing::Types<
   // BB-Tree only supports uint32_t values
   // Judy Array can only be used when both keys and values are of type uint64_t
   std::tuple<Art<uint32_t, uint64_t>, uint32_t, uint64_t, RandomNumbersFile>,
+  std::tuple<ArtOlc<uint32_t, uint64_t>, uint32_t, uint64_t, RandomNumbersFile>,
+  std::tuple<ArtPostingList<uint32_t, uint64_t>, uint32_t, uint64_t, RandomNumbersFile>,
+  std::tuple<ArtReference<uint32_t, uint64_t>, uint32_t, uint64_t, RandomNumbersFile>,
   std::tuple<BTreeGoogleAbseil<uint32_t, uint64_t>, uint32_t, uint64_t, RandomNumbersFile>,
+  std::tuple<BTreeGoogleAbseilMultimap<uint32_t, uint64_t>, uint32_t, uint64_t, RandomNumbersFile>,
   std::tuple<BTreeTlx<uint32_t, uint64_t>, uint32_t, uint64_t, RandomNumbersFile>,
+  std::tuple<BTreeTlxMultimap<uint32_t, uint64_t>, uint32_t, uint64_t, RandomNumbersFile>,
+  std::tuple<BTreeTlxPartitioned<uint32_t, uint64_t>, uint32_t, uint64_t, RandomNumbersFile>,
+  std::tuple<BwTreeIndex<uint32_t, uint64_t>, uint32_t, uint64_t, RandomNumbersFile>,
+  std::tuple<ColumnarSortedVector<uint32_t, uint64_t>, uint32_t, uint64_t, RandomNumbersFile>,
+  std::tuple<Cssl<uint32_t, uint64_t>, uint32_t, uint64_t, RandomNumbersFile>,
+  std::tuple<EytzingerArray<uint32_t, uint64_t>, uint32_t, uint64_t, RandomNumbersFile>,
   std::tuple<HashMapRobinHoodFlat<uint32_t, uint64_t>, uint32_t, uint64_t, RandomNumbersFile>,
   std::tuple<HashMapRobinHoodNode<uint32_t, uint64_t>, uint32_t, uint64_t, RandomNumbersFile>,
+  std::tuple<HashMapRobinHoodPostingList<uint32_t, uint64_t>, uint32_t, uint64_t, RandomNumbersFile>,
   std::tuple<HashMapTslRobin<uint32_t, uint64_t>, uint32_t, uint64_t, RandomNumbersFile>,
   std::tuple<HashMapTslSparse<uint32_t, uint64_t>, uint32_t, uint64_t, RandomNumbersFile>,
+  std::tuple<ShardedHashMap<HashMapRobinHoodFlat, uint32_t, uint64_t>, uint32_t, uint64_t, RandomNumbersFile>,
+  std::tuple<ShardedHashMap<HashMapTslRobin, uint32_t, uint64_t>, uint32_t, uint64_t, RandomNumbersFile>,
+  std::tuple<Masstree<uint32_t, uint64_t>, uint32_t, uint64_t, RandomNumbersFile>,
+  std::tuple<PiecewiseLinearIndex<uint32_t, uint64_t>, uint32_t, uint64_t, RandomNumbersFile>,
+  std::tuple<SimdSortedVector<uint32_t, uint64_t>, uint32_t, uint64_t, RandomNumbersFile>,
   std::tuple<SimpleVector<uint32_t, uint64_t>, uint32_t, uint64_t, RandomNumbersFile>,
   std::tuple<SkipList<uint32_t, uint64_t>, uint32_t, uint64_t, RandomNumbersFile>,
   std::tuple<SortedVector<uint32_t, uint64_t>, uint32_t, uint64_t, RandomNumbersFile>,
@@ -135,13 +243,27 @@ using CompetitorTestingTypes = ::testing::Types<
   // !!! using TID = uint64_t; is defined in N.h of the ARTSynchronized library. Setting it to
   // TID = uint32_t; allows experiments with the below test
   // std::tuple<Art<uint64_t, uint32_t>, uint64_t, uint32_t>,
+  // std::tuple<ArtOlc<uint64_t, uint32_t>, uint64_t, uint32_t>,
   std::tuple<BbTree<uint64_t, uint32_t>, uint64_t, uint32_t, RandomNumbersFile>,
   std::tuple<BTreeGoogleAbseil<uint64_t, uint32_t>, uint64_t, uint32_t, RandomNumbersFile>,
+  std::tuple<BTreeGoogleAbseilMultimap<uint64_t, uint32_t>, uint64_t, uint32_t, RandomNumbersFile>,
   std::tuple<BTreeTlx<uint64_t, uint32_t>, uint64_t, uint32_t, RandomNumbersFile>,
+  std::tuple<BTreeTlxMultimap<uint64_t, uint32_t>, uint64_t, uint32_t, RandomNumbersFile>,
+  std::tuple<BTreeTlxPartitioned<uint64_t, uint32_t>, uint64_t, uint32_t, RandomNumbersFile>,
+  std::tuple<BwTreeIndex<uint64_t, uint32_t>, uint64_t, uint32_t, RandomNumbersFile>,
+  std::tuple<ColumnarSortedVector<uint64_t, uint32_t>, uint64_t, uint32_t, RandomNumbersFile>,
+  std::tuple<Cssl<uint64_t, uint32_t>, uint64_t, uint32_t, RandomNumbersFile>,
+  std::tuple<EytzingerArray<uint64_t, uint32_t>, uint64_t, uint32_t, RandomNumbersFile>,
   std::tuple<HashMapRobinHoodFlat<uint64_t, uint32_t>, uint64_t, uint32_t, RandomNumbersFile>,
   std::tuple<HashMapRobinHoodNode<uint64_t, uint32_t>, uint64_t, uint32_t, RandomNumbersFile>,
+  std::tuple<HashMapRobinHoodPostingList<uint64_t, uint32_t>, uint64_t, uint32_t, RandomNumbersFile>,
   std::tuple<HashMapTslRobin<uint64_t, uint32_t>, uint64_t, uint32_t, RandomNumbersFile>,
   std::tuple<HashMapTslSparse<uint64_t, uint32_t>, uint64_t, uint32_t, RandomNumbersFile>,
+  std::tuple<ShardedHashMap<HashMapRobinHoodFlat, uint64_t, uint32_t>, uint64_t, uint32_t, RandomNumbersFile>,
+  std::tuple<ShardedHashMap<HashMapTslRobin, uint64_t, uint32_t>, uint64_t, uint32_t, RandomNumbersFile>,
+  std::tuple<Masstree<uint64_t, uint32_t>, uint64_t, uint32_t, RandomNumbersFile>,
+  std::tuple<PiecewiseLinearIndex<uint64_t, uint32_t>, uint64_t, uint32_t, RandomNumbersFile>,
+  std::tuple<SimdSortedVector<uint64_t, uint32_t>, uint64_t, uint32_t, RandomNumbersFile>,
   std::tuple<SimpleVector<uint64_t, uint32_t>, uint64_t, uint32_t, RandomNumbersFile>,
   std::tuple<SkipList<uint64_t, uint32_t>, uint64_t, uint32_t, RandomNumbersFile>,
   std::tuple<SortedVector<uint64_t, uint32_t>, uint64_t, uint32_t, RandomNumbersFile>,
@@ -151,13 +273,27 @@ using CompetitorTestingTypes = ::testing::Types<
   // !!! using TID = uint64_t; is defined in N.h of the ARTSynchronized library. Setting it to
   // TID = uint32_t; allows experiments with the below test
   // std::tuple<Art<uint32_t, uint32_t>, uint32_t, uint32_t>,
+  // std::tuple<ArtOlc<uint32_t, uint32_t>, uint32_t, uint32_t>,
   std::tuple<BbTree<uint32_t, uint32_t>, uint32_t, uint32_t, RandomNumbersFile>,
   std::tuple<BTreeGoogleAbseil<uint32_t, uint32_t>, uint32_t, uint32_t, RandomNumbersFile>,
+  std::tuple<BTreeGoogleAbseilMultimap<uint32_t, uint32_t>, uint32_t, uint32_t, RandomNumbersFile>,
   std::tuple<BTreeTlx<uint32_t, uint32_t>, uint32_t, uint32_t, RandomNumbersFile>,
+  std::tuple<BTreeTlxMultimap<uint32_t, uint32_t>, uint32_t, uint32_t, RandomNumbersFile>,
+  std::tuple<BTreeTlxPartitioned<uint32_t, uint32_t>, uint32_t, uint32_t, RandomNumbersFile>,
+  std::tuple<BwTreeIndex<uint32_t, uint32_t>, uint32_t, uint32_t, RandomNumbersFile>,
+  std::tuple<ColumnarSortedVector<uint32_t, uint32_t>, uint32_t, uint32_t, RandomNumbersFile>,
+  std::tuple<Cssl<uint32_t, uint32_t>, uint32_t, uint32_t, RandomNumbersFile>,
+  std::tuple<EytzingerArray<uint32_t, uint32_t>, uint32_t, uint32_t, RandomNumbersFile>,
   std::tuple<HashMapRobinHoodFlat<uint32_t, uint32_t>, uint32_t, uint32_t, RandomNumbersFile>,
   std::tuple<HashMapRobinHoodNode<uint32_t, uint32_t>, uint32_t, uint32_t, RandomNumbersFile>,
+  std::tuple<HashMapRobinHoodPostingList<uint32_t, uint32_t>, uint32_t, uint32_t, RandomNumbersFile>,
   std::tuple<HashMapTslRobin<uint32_t, uint32_t>, uint32_t, uint32_t, RandomNumbersFile>,
   std::tuple<HashMapTslSparse<uint32_t, uint32_t>, uint32_t, uint32_t, RandomNumbersFile>,
+  std::tuple<ShardedHashMap<HashMapRobinHoodFlat, uint32_t, uint32_t>, uint32_t, uint32_t, RandomNumbersFile>,
+  std::tuple<ShardedHashMap<HashMapTslRobin, uint32_t, uint32_t>, uint32_t, uint32_t, RandomNumbersFile>,
+  std::tuple<Masstree<uint32_t, uint32_t>, uint32_t, uint32_t, RandomNumbersFile>,
+  std::tuple<PiecewiseLinearIndex<uint32_t, uint32_t>, uint32_t, uint32_t, RandomNumbersFile>,
+  std::tuple<SimdSortedVector<uint32_t, uint32_t>, uint32_t, uint32_t, RandomNumbersFile>,
   std::tuple<SimpleVector<uint32_t, uint32_t>, uint32_t, uint32_t, RandomNumbersFile>,
   std::tuple<SkipList<uint32_t, uint32_t>, uint32_t, uint32_t, RandomNumbersFile>,
   std::tuple<SortedVector<uint32_t, uint32_t>, uint32_t, uint32_t, RandomNumbersFile>,
@@ -190,7 +326,7 @@ class CompetitorTestBinaryTestData : public ::testing::Test {
     SortedVector<Key, Value> validation_index;
     validation_index.bulk_insert(data);
     // fill the column used by the ART index
-    Column<Key, Value>::fill(data.entries);
+    Column<Key, Value>::fill(data.entries());
     return TestData<Key, Value>{std::move(data), std::move(equality_lookups), std::move(range_lookups),
                                 std::move(validation_index)};
   }
@@ -213,16 +349,17 @@ TYPED_TEST(CompetitorTestBinaryTestData, BulkLoadEqualityLookup) {
     return;
   }
 
-  if (Index::type() == IndexType::BTreeTLX) {
-    // the bulk load operation of the BTreeTLX requires sorted entries
-    auto entries = test_data.data.entries;
+  if (Index::type() == IndexType::BTreeTLX || Index::type() == IndexType::BTreeTLXMultimap ||
+      Index::type() == IndexType::BTreeTLXPartitioned) {
+    // the bulk load operation of the TLX B+ trees requires sorted entries
+    auto entries = test_data.data.entries();
     std::sort(entries.begin(), entries.end());
     index.bulk_load(Data<Key, Value>{{}, {}, std::move(entries), {}});
   } else {
     index.bulk_load(test_data.data);
   }
 
-  for (const auto& entry : test_data.data.entries) {
+  for (const auto& entry : test_data.data.entries()) {
     const auto actual_result = index.equality_lookup(entry.first);
     EXPECT_EQ(actual_result, std::vector<Value>{entry.second});
   }
@@ -242,7 +379,7 @@ TYPED_TEST(CompetitorTestBinaryTestData, BulkInsertEqualityLookup) {
 
   index.bulk_insert(test_data.data);
 
-  for (const auto& entry : test_data.data.entries) {
+  for (const auto& entry : test_data.data.entries()) {
     const auto actual_result = index.equality_lookup(entry.first);
     EXPECT_EQ(actual_result, std::vector<Value>{entry.second});
   }
@@ -254,7 +391,7 @@ TYPED_TEST(CompetitorTestBinaryTestData, InsertEqualityLookup) {
   const auto test_data = this->setup_test_data(File::name);
   Index index;
   // store all entries
-  for (const auto& entry : test_data.data.entries) {
+  for (const auto& entry : test_data.data.entries()) {
     index.insert(entry.first, entry.second);
   }
   // perform lookups
@@ -273,7 +410,7 @@ TYPED_TEST(CompetitorTestBinaryTestData, InsertRangeLookup) {
   // store all entries
   const auto test_data = this->setup_test_data(File::name);
   Index index;
-  for (const auto& entry : test_data.data.entries) {
+  for (const auto& entry : test_data.data.entries()) {
     {
       const auto result = index.equality_lookup(entry.first);
       EXPECT_TRUE(result.empty());
@@ -310,11 +447,11 @@ TYPED_TEST(CompetitorTestBinaryTestData, InsertEqualityLookupErase) {
   // store all entries
   const auto test_data = this->setup_test_data(File::name);
   Index index;
-  for (const auto& entry : test_data.data.entries) {
+  for (const auto& entry : test_data.data.entries()) {
     index.insert(entry.first, entry.second);
   }
 
-  for (const auto& entry : test_data.data.entries) {
+  for (const auto& entry : test_data.data.entries()) {
     const auto lookup_result_before_erase = index.equality_lookup(entry.first);
     EXPECT_EQ(lookup_result_before_erase, std::vector<Value>{entry.second});
     index.erase(entry.first, entry.second);
@@ -323,4 +460,50 @@ TYPED_TEST(CompetitorTestBinaryTestData, InsertEqualityLookupErase) {
   }
 }
 
+
+// Executes the operations that an index supports concurrently with multiple threads. Operations that are not supported
+// concurrently are executed by the main thread.
+TYPED_TEST(CompetitorTestBinaryTestData, ConcurrentInsertEqualityLookupErase) {
+  using Index = typename std::tuple_element<0, TypeParam>::type;
+  using Value = typename std::tuple_element<2, TypeParam>::type;
+  using File = typename std::tuple_element<3, TypeParam>::type;
+  constexpr auto thread_count = size_t{4};
+
+  const auto test_data = this->setup_test_data(File::name);
+  const auto& entries = test_data.data.entries();
+  Index index;
+  const auto insert = [&](const size_t begin, const size_t end) {
+    for (auto entry_index = begin; entry_index < end; ++entry_index) {
+      index.insert(entries[entry_index].first, entries[entry_index].second);
+    }
+  };
+  if (Index::supports_concurrent(IndexOperationType::InsertEntry)) {
+    ParallelExecutor::execute(thread_count, entries.size(), insert);
+  } else {
+    insert(0, entries.size());
+  }
+
+  if (!Index::supports_concurrent(IndexOperationType::EqualityLookup)) {
+    return;
+  }
+  ParallelExecutor::execute(thread_count, entries.size(), [&](const size_t begin, const size_t end) {
+    for (auto entry_index = begin; entry_index < end; ++entry_index) {
+      const auto actual_result = index.equality_lookup(entries[entry_index].first);
+      EXPECT_EQ(actual_result, std::vector<Value>{entries[entry_index].second});
+    }
+  });
+
+  if (!Index::supports_concurrent(IndexOperationType::EraseEntry)) {
+    return;
+  }
+  ParallelExecutor::execute(thread_count, entries.size(), [&](const size_t begin, const size_t end) {
+    for (auto entry_index = begin; entry_index < end; ++entry_index) {
+      index.erase(entries[entry_index].first, entries[entry_index].second);
+    }
+  });
+  for (const auto& entry : entries) {
+    EXPECT_TRUE(index.equality_lookup(entry.first).empty());
+  }
+}
+
 }  // namespace imib
@@ -1,3 +1,9 @@
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
 #include "gtest/gtest.h"
 
 #include "data/data_generator.hpp"
@@ -30,16 +36,8 @@ class DataGeneratorTest : public ::testing::Test {
                                             {247178370, 8},
                                             {54179823, 9},
                                             {4952018, 10}},
-      std::vector<std::vector<float>>{{286631063.0f},
-                                      {9501002.0f},
-                                      {74021799.0f},
-                                      {149956189.0f},
-                                      {866868337.0f},
-                                      {118600844.0f},
-                                      {356840142.0f},
-                                      {247178370.0f},
-                                      {54179823.0f},
-                                      {4952018.0f}}};
+      std::vector<float>{286631063.0f, 9501002.0f, 74021799.0f, 149956189.0f, 866868337.0f, 118600844.0f, 356840142.0f,
+                         247178370.0f, 54179823.0f, 4952018.0f}};
   const Data<uint64_t, TID> _expected_data_64_bit_keys{
       std::vector<uint64_t>{214270672601648144, 7268948875237948928, 2705205453094070272, 1146895480282342016,
                             2754943524098997760, 593666090391845760, 3499648365188541440, 1992215875722076672,
@@ -55,16 +53,9 @@ class DataGeneratorTest : public ::testing::Test {
                                             {1992215875722076672, 8},
                                             {2559942653427277824, 9},
                                             {658834507063769216, 10}},
-      std::vector<std::vector<float>>{{214270672601648144.0f},
-                                      {7268948875237948928.0f},
-                                      {2705205453094070272.0f},
-                                      {1146895480282342016.0f},
-                                      {2754943524098997760.0f},
-                                      {593666090391845760.0f},
-                                      {3499648365188541440.0f},
-                                      {1992215875722076672.0f},
-                                      {2559942653427277824.0f},
-                                      {658834507063769216.0f}}};
+      std::vector<float>{214270672601648144.0f, 7268948875237948928.0f, 2705205453094070272.0f, 1146895480282342016.0f,
+                         2754943524098997760.0f, 593666090391845760.0f, 3499648365188541440.0f, 1992215875722076672.0f,
+                         2559942653427277824.0f, 658834507063769216.0f}};
 };
 
 using TID_types = ::testing::Types<uint32_t, uint64_t>;
@@ -75,18 +66,83 @@ TYPED_TEST_SUITE(DataGeneratorTest, TID_types);
 
 TYPED_TEST(DataGeneratorTest, GenerateTestData32BitKeys) {
   const auto actual_data = DataGenerator::generate<uint32_t, TypeParam>("../resources/test_data/books_10_uint32");
-  EXPECT_EQ(actual_data.keys, this->_expected_data_32_bit_keys.keys);
-  EXPECT_EQ(actual_data.values, this->_expected_data_32_bit_keys.values);
-  EXPECT_EQ(actual_data.entries, this->_expected_data_32_bit_keys.entries);
-  EXPECT_EQ(actual_data.keys_float, this->_expected_data_32_bit_keys.keys_float);
+  EXPECT_EQ(actual_data.keys(), this->_expected_data_32_bit_keys.keys());
+  EXPECT_EQ(actual_data.values(), this->_expected_data_32_bit_keys.values());
+  EXPECT_EQ(actual_data.entries(), this->_expected_data_32_bit_keys.entries());
+  EXPECT_EQ(actual_data.keys_float(), this->_expected_data_32_bit_keys.keys_float());
 }
 
 TYPED_TEST(DataGeneratorTest, GenerateTestData64BitKeys) {
   const auto actual_data = DataGenerator::generate<uint64_t, TypeParam>("../resources/test_data/books_10_uint64");
-  EXPECT_EQ(actual_data.keys, this->_expected_data_64_bit_keys.keys);
-  EXPECT_EQ(actual_data.values, this->_expected_data_64_bit_keys.values);
-  EXPECT_EQ(actual_data.entries, this->_expected_data_64_bit_keys.entries);
-  EXPECT_EQ(actual_data.keys_float, this->_expected_data_64_bit_keys.keys_float);
+  EXPECT_EQ(actual_data.keys(), this->_expected_data_64_bit_keys.keys());
+  EXPECT_EQ(actual_data.values(), this->_expected_data_64_bit_keys.values());
+  EXPECT_EQ(actual_data.entries(), this->_expected_data_64_bit_keys.entries());
+  EXPECT_EQ(actual_data.keys_float(), this->_expected_data_64_bit_keys.keys_float());
+}
+
+// the mapping options only change how the file is mapped, not the data
+TYPED_TEST(DataGeneratorTest, GenerateWithMappingOptions) {
+  const auto actual_data = DataGenerator::generate<uint64_t, TypeParam>("../resources/test_data/books_10_uint64",
+                                                                        MappingOptions{true, true});
+  EXPECT_EQ(actual_data.entries(), this->_expected_data_64_bit_keys.entries());
+}
+
+// the representations are materialized once, copies of the data and concurrent first accesses share them
+TYPED_TEST(DataGeneratorTest, MaterializeRepresentationsOnce) {
+  const auto data = DataGenerator::generate<uint64_t, TypeParam>("../resources/test_data/books_10K_uint64");
+  const auto data_copy = data;
+  auto entries = std::vector<const std::vector<std::pair<uint64_t, TypeParam>>*>(4);
+  auto threads = std::vector<std::thread>{};
+  for (size_t thread_index = 0; thread_index < entries.size(); ++thread_index) {
+    threads.emplace_back([&, thread_index] { entries[thread_index] = &data_copy.entries(); });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  for (const auto* thread_entries : entries) {
+    EXPECT_EQ(thread_entries, &data.entries());
+  }
+  ASSERT_EQ(data.entries().size(), 10000u);
+  EXPECT_EQ(data.entries()[9999].second, 10000u);
+  EXPECT_EQ(data.keys_float().size(), 10000u);
+}
+
+// ascending keys are unique without sorting a copy of the keys, other keys are sorted first
+TYPED_TEST(DataGeneratorTest, UniqueKeys) {
+  const auto ascending_keys = std::vector<uint64_t>{1, 2, 5, 9};
+  const auto ascending_data = Data<uint64_t, TypeParam>{std::span<const uint64_t>{ascending_keys}, nullptr};
+  EXPECT_TRUE(ascending_data.unique_keys());
+  const auto shuffled_keys = std::vector<uint64_t>{9, 1, 5, 2};
+  EXPECT_TRUE((Data<uint64_t, TypeParam>{std::span<const uint64_t>{shuffled_keys}, nullptr}.unique_keys()));
+  const auto duplicate_keys = std::vector<uint64_t>{1, 2, 2, 9};
+  EXPECT_FALSE((Data<uint64_t, TypeParam>{std::span<const uint64_t>{duplicate_keys}, nullptr}.unique_keys()));
+  const auto shuffled_duplicate_keys = std::vector<uint64_t>{9, 2, 5, 2};
+  EXPECT_FALSE((Data<uint64_t, TypeParam>{std::span<const uint64_t>{shuffled_duplicate_keys}, nullptr}.unique_keys()));
+}
+
+// the string keys are views of the mapped file or of the generated arena, which the data keeps alive
+TYPED_TEST(DataGeneratorTest, GenerateStringKeys) {
+  const auto file_data =
+      DataGenerator::generate<std::string_view, TypeParam>("../resources/test_data/emails_10_string");
+  ASSERT_EQ(file_data.keys().size(), 10u);
+  EXPECT_EQ(file_data.keys()[0], "mallory.erin405@mail.example.net");
+  EXPECT_EQ(file_data.entries()[9], (std::pair<std::string_view, TypeParam>{"victor.erin297@example.org", 10}));
+  EXPECT_TRUE(file_data.unique_keys());
+
+  auto distribution = KeyDistribution{DistributionType::Uniform, 1, 100};
+  const auto generated_data = DataGenerator::generate<std::string_view, TypeParam>(distribution);
+  ASSERT_EQ(generated_data.keys().size(), 100u);
+  EXPECT_TRUE(generated_data.unique_keys());
+  for (const auto& key : generated_data.keys()) {
+    EXPECT_TRUE(key.starts_with("user")) << key;
+    EXPECT_GT(key.size(), 4u);
+  }
+  // the same keys as the integer keys of the distribution
+  const auto integer_data = DataGenerator::generate<uint64_t, TypeParam>(distribution);
+  EXPECT_EQ(generated_data.keys()[0], "user" + std::to_string(integer_data.keys()[0]));
+
+  distribution.distinct_count = 10;
+  EXPECT_FALSE((DataGenerator::generate<std::string_view, TypeParam>(distribution).unique_keys()));
 }
 
 }  // namespace imib
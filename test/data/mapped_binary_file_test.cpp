@@ -0,0 +1,42 @@
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "data/load_binary_data.hpp"
+#include "data/mapped_binary_file.hpp"
+
+namespace imib {
+
+TEST(MappedBinaryFileTest, MapValues) {
+  const auto expected_values = std::vector<uint32_t>{286631063, 9501002,   74021799, 149956189, 866868337,
+                                                     118600844, 356840142, 247178370, 54179823, 4952018};
+  const auto file = MappedBinaryFile<uint32_t>{"../resources/test_data/books_10_uint32"};
+  const auto values = file.values();
+  EXPECT_EQ(std::vector<uint32_t>(values.begin(), values.end()), expected_values);
+
+  const auto populated_file =
+      MappedBinaryFile<uint32_t>{"../resources/test_data/books_10_uint32", {.populate = true, .huge_pages = true}};
+  const auto populated_values = populated_file.values();
+  EXPECT_EQ(std::vector<uint32_t>(populated_values.begin(), populated_values.end()), expected_values);
+}
+
+TEST(MappedBinaryFileTest, LoadBinaryDataCopiesMappedValues) {
+  const auto file = MappedBinaryFile<uint64_t>{"../resources/test_data/books_10K_uint64"};
+  const auto values = file.values();
+  EXPECT_EQ(values.size(), 10000u);
+  EXPECT_EQ(load_binary_data<uint64_t>("../resources/test_data/books_10K_uint64"),
+            std::vector<uint64_t>(values.begin(), values.end()));
+}
+
+TEST(MappedBinaryFileTest, MissingFile) {
+  EXPECT_THROW(MappedBinaryFile<uint64_t>{"../resources/test_data/missing_file"}, std::logic_error);
+}
+
+// the 10 uint32 values of the file are interpreted as 5 uint64 values, which are fewer than the value count
+TEST(MappedBinaryFileTest, TruncatedFile) {
+  EXPECT_THROW(MappedBinaryFile<uint64_t>{"../resources/test_data/books_10_uint32"}, std::logic_error);
+}
+
+}  // namespace imib
@@ -0,0 +1,44 @@
+#include <cstddef>
+#include <stdexcept>
+#include <string_view>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "data/mapped_string_file.hpp"
+#include "data/string_arena.hpp"
+
+namespace imib {
+
+TEST(MappedStringFileTest, MapStrings) {
+  const auto file = MappedStringFile{"../resources/test_data/emails_10_string"};
+  const auto values = file.values();
+  ASSERT_EQ(values.size(), 10u);
+  EXPECT_EQ(values[0], "mallory.erin405@mail.example.net");
+  EXPECT_EQ(values[1], "bob.carol841@mail.example.net");
+  EXPECT_EQ(values[9], "victor.erin297@example.org");
+  // the strings follow each other in the mapping
+  EXPECT_EQ(values[1].data(), values[0].data() + values[0].size() + sizeof(uint32_t));
+}
+
+TEST(MappedStringFileTest, MissingFile) {
+  EXPECT_THROW(MappedStringFile{"../resources/test_data/missing_file"}, std::logic_error);
+}
+
+// the keys of the uint32 file are interpreted as string lengths that exceed the file
+TEST(MappedStringFileTest, TruncatedFile) {
+  EXPECT_THROW(MappedStringFile{"../resources/test_data/books_10_uint32"}, std::logic_error);
+}
+
+TEST(StringArenaTest, ViewsOfTheBytes) {
+  const auto bytes = std::string_view{"user1user12"};
+  const auto arena = StringArena{std::vector<char>(bytes.cbegin(), bytes.cend()), {5, 0, 6}};
+  const auto values = arena.values();
+  ASSERT_EQ(values.size(), 3u);
+  EXPECT_EQ(values[0], "user1");
+  EXPECT_EQ(values[1], "");
+  EXPECT_EQ(values[2], "user12");
+  EXPECT_THROW((StringArena{std::vector<char>(bytes.cbegin(), bytes.cend()), {5, 7}}), std::logic_error);
+}
+
+}  // namespace imib
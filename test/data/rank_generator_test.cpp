@@ -0,0 +1,130 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <unordered_set>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "data/lookup_generator.hpp"
+#include "data/random_key_generator.hpp"
+#include "data/rank_generator.hpp"
+
+namespace imib {
+
+class RankGeneratorTest : public ::testing::Test {
+ protected:
+  // returns how often each rank was drawn
+  static std::vector<size_t> _histogram(const KeyDistribution& distribution, const uint64_t rank_count,
+                                        const size_t draw_count) {
+    const auto rank_generator = RankGenerator{distribution, rank_count};
+    auto random_engine = std::mt19937_64{distribution.seed};
+    auto counts = std::vector<size_t>(rank_count);
+    for (size_t draw = 0; draw < draw_count; ++draw) {
+      const auto rank = rank_generator(random_engine);
+      EXPECT_LT(rank, rank_count);
+      if (rank < rank_count) {
+        ++counts[rank];
+      }
+    }
+    return counts;
+  }
+};
+
+TEST_F(RankGeneratorTest, Zipfian) {
+  // with an exponent of 1, rank 0 is drawn twice as often as rank 1 and with 1 / H(100) ~ 19% of all draws
+  const auto counts = _histogram(KeyDistribution{DistributionType::Zipfian, 1, 0, 1.0}, 100, 100'000);
+  EXPECT_NEAR(static_cast<double>(counts[0]) / 100'000.0, 0.193, 0.01);
+  EXPECT_NEAR(static_cast<double>(counts[0]) / static_cast<double>(counts[1]), 2.0, 0.1);
+  EXPECT_GT(counts[1], counts[10]);
+  EXPECT_GT(counts[10], counts[99]);
+}
+
+TEST_F(RankGeneratorTest, Latest) {
+  const auto counts = _histogram(KeyDistribution{DistributionType::Latest, 1, 0, 0.99}, 100, 100'000);
+  EXPECT_GT(counts[99], counts[98]);
+  EXPECT_GT(counts[98], counts[0]);
+}
+
+TEST_F(RankGeneratorTest, Hotspot) {
+  const auto counts = _histogram(KeyDistribution{DistributionType::Hotspot, 1, 0, 0.0, 0.9, 0.1}, 100, 100'000);
+  const auto hot_count = std::accumulate(counts.cbegin(), counts.cbegin() + 10, size_t{0});
+  EXPECT_NEAR(static_cast<double>(hot_count) / 100'000.0, 0.9, 0.01);
+}
+
+TEST_F(RankGeneratorTest, Normal) {
+  auto distribution = KeyDistribution{DistributionType::Normal, 1};
+  distribution.standard_deviation = 0.1;
+  const auto counts = _histogram(distribution, 100, 100'000);
+  // about 68% of the draws are within one standard deviation, i.e., 10 ranks around the center
+  const auto center_count = std::accumulate(counts.cbegin() + 40, counts.cbegin() + 60, size_t{0});
+  EXPECT_NEAR(static_cast<double>(center_count) / 100'000.0, 0.68, 0.05);
+}
+
+TEST_F(RankGeneratorTest, WholeKeyDomain) {
+  const auto rank_generator =
+      RankGenerator{KeyDistribution{DistributionType::Zipfian, 1, 0, 0.99}, std::numeric_limits<uint64_t>::max()};
+  auto random_engine = std::mt19937_64{1};
+  for (size_t draw = 0; draw < 1'000; ++draw) {
+    EXPECT_LT(rank_generator(random_engine), std::numeric_limits<uint64_t>::max());
+  }
+}
+
+TEST_F(RankGeneratorTest, GenerateUniqueKeys) {
+  const auto distribution = KeyDistribution{DistributionType::Zipfian, 7, 1'000};
+  const auto keys = RandomKeyGenerator::generate<uint32_t>(distribution, true);
+  ASSERT_EQ(keys.size(), 1'000);
+  EXPECT_EQ(std::unordered_set<uint32_t>(keys.cbegin(), keys.cend()).size(), 1'000);
+  EXPECT_EQ(*std::min_element(keys.cbegin(), keys.cend()), 1);
+  // the keys only depend on the seed
+  EXPECT_EQ(RandomKeyGenerator::generate<uint32_t>(distribution, true), keys);
+}
+
+TEST_F(RankGeneratorTest, GenerateDuplicateKeys) {
+  auto distribution = KeyDistribution{DistributionType::Zipfian, 7, 1'000};
+  distribution.distinct_count = 10;
+  const auto keys = RandomKeyGenerator::generate<uint32_t>(distribution, false);
+  ASSERT_EQ(keys.size(), 1'000);
+  const auto distinct_keys = std::unordered_set<uint32_t>(keys.cbegin(), keys.cend());
+  EXPECT_LE(distinct_keys.size(), 10);
+  EXPECT_GT(distinct_keys.size(), 1);
+  // unique keys cannot be drawn from fewer distinct keys than keys
+  EXPECT_THROW(RandomKeyGenerator::generate<uint32_t>(distribution, true), std::logic_error);
+  EXPECT_EQ(RandomKeyGenerator::describe(distribution), "zipfian(count=1000, skew=0.99, distinct_count=10, seed=7)");
+}
+
+TEST_F(RankGeneratorTest, GenerateLookups) {
+  auto keys = std::vector<uint64_t>(1'000);
+  std::iota(keys.begin(), keys.end(), uint64_t{1});
+  const auto equality_lookups =
+      LookupGenerator::generate_equality_lookups(keys, KeyDistribution{DistributionType::Latest, 3, 10'000});
+  ASSERT_EQ(equality_lookups.size(), 10'000);
+  const auto latest_count = std::count_if(equality_lookups.cbegin(), equality_lookups.cend(),
+                                          [](const auto& lookup) { return lookup.key > 990; });
+  EXPECT_GT(latest_count, 3'000);
+
+  const auto range_lookups =
+      LookupGenerator::generate_range_lookups(keys, KeyDistribution{DistributionType::Uniform, 3, 100}, 10);
+  ASSERT_EQ(range_lookups.size(), 100);
+  for (const auto& lookup : range_lookups) {
+    EXPECT_EQ(lookup.upper_bound_key - lookup.lower_bound_key, std::min(uint64_t{9}, 1'000 - lookup.lower_bound_key));
+  }
+  EXPECT_THROW(LookupGenerator::generate_equality_lookups(std::vector<uint64_t>{}, KeyDistribution{}),
+               std::logic_error);
+}
+
+TEST_F(RankGeneratorTest, DistributionNames) {
+  for (const auto type : {DistributionType::Normal, DistributionType::Uniform, DistributionType::Zipfian,
+                          DistributionType::Hotspot, DistributionType::Latest}) {
+    EXPECT_EQ(RandomKeyGenerator::distribution_type(RandomKeyGenerator::distribution_name(type)), type);
+  }
+  EXPECT_THROW(RandomKeyGenerator::distribution_type("pareto"), std::logic_error);
+  EXPECT_EQ(RandomKeyGenerator::describe(KeyDistribution{DistributionType::Zipfian, 42, 100, 0.99}),
+            "zipfian(count=100, skew=0.99, seed=42)");
+}
+
+}  // namespace imib
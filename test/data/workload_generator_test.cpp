@@ -0,0 +1,106 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "data/workload_generator.hpp"
+
+namespace imib {
+
+class WorkloadGeneratorTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    for (uint64_t key = 0; key < 1000; ++key) {
+      _entries.emplace_back(key, key + 1);
+    }
+  }
+
+  static size_t _count(const Workload<uint64_t, uint64_t>& workload, const WorkloadOperationType type) {
+    return static_cast<size_t>(std::count_if(workload.operations.cbegin(), workload.operations.cend(),
+                                             [&](const auto& operation) { return operation.type == type; }));
+  }
+
+  Entries<uint64_t, uint64_t> _entries;
+};
+
+TEST_F(WorkloadGeneratorTest, OperationShares) {
+  const auto mix = WorkloadMix{"Mix", 50, 30, 10, 10};
+  const auto workload = WorkloadGenerator::generate<uint64_t, uint64_t>(mix, _entries, 10'000, 100, 50);
+  ASSERT_EQ(workload.operations.size(), 10'000);
+  EXPECT_NEAR(_count(workload, WorkloadOperationType::EqualityLookup), 5'000, 300);
+  EXPECT_NEAR(_count(workload, WorkloadOperationType::RangeLookup), 3'000, 300);
+  EXPECT_NEAR(_count(workload, WorkloadOperationType::Insert), 1'000, 200);
+  EXPECT_NEAR(_count(workload, WorkloadOperationType::Update), 1'000, 200);
+
+  for (const auto& operation : workload.operations) {
+    switch (operation.type) {
+      case WorkloadOperationType::EqualityLookup:
+        EXPECT_LT(operation.position, 100);
+        break;
+      case WorkloadOperationType::RangeLookup:
+        EXPECT_LT(operation.position, 50);
+        break;
+      case WorkloadOperationType::Insert:
+        EXPECT_LT(operation.position, workload.insert_entries.size());
+        break;
+      case WorkloadOperationType::Update:
+        EXPECT_LT(operation.position, workload.initial_entries.size());
+        break;
+    }
+  }
+}
+
+TEST_F(WorkloadGeneratorTest, HoldsBackOneEntryPerInsert) {
+  const auto mix = WorkloadMix{"Mix", 90, 0, 10, 0};
+  const auto workload = WorkloadGenerator::generate<uint64_t, uint64_t>(mix, _entries, 1'000, 100, 0);
+  const auto insert_count = _count(workload, WorkloadOperationType::Insert);
+  EXPECT_EQ(workload.insert_entries.size(), insert_count);
+  EXPECT_EQ(workload.initial_entries.size() + workload.insert_entries.size(), _entries.size());
+
+  // each entry is either an initial entry or inserted
+  auto all_entries = workload.initial_entries;
+  all_entries.insert(all_entries.end(), workload.insert_entries.cbegin(), workload.insert_entries.cend());
+  std::sort(all_entries.begin(), all_entries.end());
+  EXPECT_EQ(all_entries, _entries);
+
+  // the inserted entries are spread over the keys and not inserted in ascending order
+  EXPECT_GT(std::max_element(workload.insert_entries.cbegin(), workload.insert_entries.cend())->first, 800);
+  EXPECT_FALSE(std::is_sorted(workload.insert_entries.cbegin(), workload.insert_entries.cend()));
+}
+
+TEST_F(WorkloadGeneratorTest, SameTraceForSameArguments) {
+  const auto mix = WorkloadMix{"Mix", 50, 0, 0, 50};
+  const auto first = WorkloadGenerator::generate<uint64_t, uint64_t>(mix, _entries, 1'000, 100, 0);
+  const auto second = WorkloadGenerator::generate<uint64_t, uint64_t>(mix, _entries, 1'000, 100, 0);
+  ASSERT_EQ(first.operations.size(), second.operations.size());
+  for (size_t operation = 0; operation < first.operations.size(); ++operation) {
+    EXPECT_EQ(first.operations[operation].type, second.operations[operation].type);
+    EXPECT_EQ(first.operations[operation].position, second.operations[operation].position);
+  }
+}
+
+TEST_F(WorkloadGeneratorTest, InvalidWorkloads) {
+  EXPECT_THROW((WorkloadGenerator::generate<uint64_t, uint64_t>(WorkloadMix{"Empty"}, _entries, 100, 100, 100)),
+               std::logic_error);
+  // range lookups without range lookups to execute
+  EXPECT_THROW((WorkloadGenerator::generate<uint64_t, uint64_t>(WorkloadMix{"Scan", 0, 1, 0, 0}, _entries, 100, 100,
+                                                                0)),
+               std::logic_error);
+  // more inserts than entries
+  EXPECT_THROW((WorkloadGenerator::generate<uint64_t, uint64_t>(WorkloadMix{"Insert", 0, 0, 1, 0}, _entries, 2'000,
+                                                                100, 100)),
+               std::logic_error);
+}
+
+TEST_F(WorkloadGeneratorTest, OperationNames) {
+  EXPECT_EQ(WorkloadGenerator::operation_name(WorkloadOperationType::EqualityLookup), "EqualityLookup");
+  EXPECT_EQ(WorkloadGenerator::operation_name(WorkloadOperationType::RangeLookup), "RangeLookup");
+  EXPECT_EQ(WorkloadGenerator::operation_name(WorkloadOperationType::Insert), "Insert");
+  EXPECT_EQ(WorkloadGenerator::operation_name(WorkloadOperationType::Update), "Update");
+}
+
+}  // namespace imib
@@ -0,0 +1,74 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "evaluation/latency_histogram.hpp"
+
+namespace imib {
+
+class LatencyHistogramTest : public ::testing::Test {};
+
+TEST_F(LatencyHistogramTest, Empty) {
+  const auto histogram = LatencyHistogram{};
+  EXPECT_EQ(histogram.count(), 0);
+  EXPECT_EQ(histogram.min(), 0);
+  EXPECT_EQ(histogram.max(), 0);
+  EXPECT_EQ(histogram.percentile(50.0), 0);
+}
+
+// the values below 128 have their own bucket
+TEST_F(LatencyHistogramTest, SmallValuesAreExact) {
+  auto histogram = LatencyHistogram{};
+  for (uint64_t value = 1; value <= 100; ++value) {
+    histogram.record(value);
+  }
+  EXPECT_EQ(histogram.count(), 100);
+  EXPECT_EQ(histogram.min(), 1);
+  EXPECT_EQ(histogram.max(), 100);
+  EXPECT_EQ(histogram.percentile(0.0), 1);
+  EXPECT_EQ(histogram.percentile(50.0), 50);
+  EXPECT_EQ(histogram.percentile(99.0), 99);
+  EXPECT_EQ(histogram.percentile(100.0), 100);
+}
+
+TEST_F(LatencyHistogramTest, BoundedRelativeError) {
+  auto random_engine = std::mt19937_64{42};
+  auto values = std::vector<uint64_t>(10'000);
+  for (auto& value : values) {
+    // spread the values over many powers of two
+    value = random_engine() >> (random_engine() % 64);
+  }
+  auto histogram = LatencyHistogram{};
+  for (const auto value : values) {
+    histogram.record(value);
+  }
+  std::sort(values.begin(), values.end());
+  for (const auto percentile : {1.0, 10.0, 50.0, 90.0, 99.0, 99.9}) {
+    const auto rank = static_cast<size_t>(std::ceil(percentile / 100.0 * static_cast<double>(values.size())));
+    const auto exact_value = values[rank - 1];
+    const auto value = histogram.percentile(percentile);
+    EXPECT_GE(value, exact_value);
+    EXPECT_LE(static_cast<double>(value - exact_value), static_cast<double>(exact_value) / 64.0);
+  }
+  EXPECT_EQ(histogram.percentile(100.0), values.back());
+}
+
+TEST_F(LatencyHistogramTest, Merge) {
+  auto histogram = LatencyHistogram{};
+  auto other = LatencyHistogram{};
+  histogram.record(10);
+  other.record(5);
+  other.record(1'000'000);
+  histogram.merge(other);
+  histogram.merge(LatencyHistogram{});
+  EXPECT_EQ(histogram.count(), 3);
+  EXPECT_EQ(histogram.min(), 5);
+  EXPECT_EQ(histogram.max(), 1'000'000);
+  EXPECT_EQ(histogram.percentile(50.0), 10);
+}
+
+}  // namespace imib
@@ -0,0 +1,53 @@
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+#include "gtest/gtest.h"
+
+#include "evaluation/performance_counters.hpp"
+#include "evaluation/report.hpp"
+
+namespace imib {
+
+class PerformanceCountersTest : public ::testing::Test {};
+
+// the counters are not available on every machine, thus, only the counted events are checked
+TEST_F(PerformanceCountersTest, CountsBusyLoop) {
+  auto counters = PerformanceCounters{};
+  counters.start();
+  volatile auto sum = uint64_t{0};
+  for (auto i = uint64_t{0}; i < 1'000'000; ++i) {
+    sum = sum + i;
+  }
+  const auto counts = counters.stop();
+
+  const auto& instructions = counts[static_cast<size_t>(HardwareEvent::Instructions)];
+  if (instructions) {
+    EXPECT_GE(*instructions, 1'000'000);
+  }
+  const auto& cycles = counts[static_cast<size_t>(HardwareEvent::Cycles)];
+  if (cycles) {
+    EXPECT_GT(*cycles, 0);
+  }
+}
+
+TEST_F(PerformanceCountersTest, EventsPerOperation) {
+  auto event_counts = HardwareEventCounts{};
+  event_counts[static_cast<size_t>(HardwareEvent::Cycles)] = 1000;
+  const auto measurement = Measurements{std::chrono::nanoseconds{1}, 0, 10, event_counts};
+  EXPECT_DOUBLE_EQ(*measurement.events_per_operation(HardwareEvent::Cycles), 100.0);
+  EXPECT_FALSE(measurement.events_per_operation(HardwareEvent::Instructions));
+
+  const auto no_operations = Measurements{std::chrono::nanoseconds{1}, 0, 0, event_counts};
+  EXPECT_FALSE(no_operations.events_per_operation(HardwareEvent::Cycles));
+}
+
+TEST_F(PerformanceCountersTest, EventNames) {
+  EXPECT_EQ(PerformanceCounters::event_name(HardwareEvent::Cycles), "cycles");
+  EXPECT_EQ(PerformanceCounters::event_name(HardwareEvent::Instructions), "instructions");
+  EXPECT_EQ(PerformanceCounters::event_name(HardwareEvent::LLCMisses), "llc_misses");
+  EXPECT_EQ(PerformanceCounters::event_name(HardwareEvent::DTLBMisses), "dtlb_misses");
+  EXPECT_EQ(PerformanceCounters::event_name(HardwareEvent::BranchMisses), "branch_misses");
+}
+
+}  // namespace imib
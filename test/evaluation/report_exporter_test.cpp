@@ -0,0 +1,66 @@
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+#include "gtest/gtest.h"
+#include "nlohmann/json.hpp"
+
+#include "evaluation/report.hpp"
+#include "evaluation/report_exporter.hpp"
+
+namespace imib {
+
+class ReportExporterTest : public ::testing::Test {
+ protected:
+  static nlohmann::json _export(const Report& report) {
+    const auto file_path = std::filesystem::temp_directory_path() / "imib_report_exporter_test.json";
+    ReportExporter{report, file_path.string()}.execute();
+    auto file = std::ifstream{file_path};
+    const auto json_report = nlohmann::json::parse(file);
+    std::filesystem::remove(file_path);
+    return json_report;
+  }
+};
+
+// the analysis scripts (scripts/json_utils.py) expect this shape of the executions
+TEST_F(ReportExporterTest, ExecutionShape) {
+  auto plain_execution = ExecutionStatistics{};
+  plain_execution.measurements.emplace_back(std::chrono::nanoseconds{500}, 64);
+  auto bulk_erase_execution = ExecutionStatistics{};
+  bulk_erase_execution.measurements.emplace_back(std::chrono::nanoseconds{1'000}, 32, 100, HardwareEventCounts{});
+  bulk_erase_execution.freed_bytes = 16;
+
+  auto report = Report{};
+  report.benchmark_configuration.iterations = 2;
+  report.benchmark_configuration.threads = 1;
+  report.case_statistics.push_back(
+      {"BulkErase", "Sorted Vector", "uint64_t", "uint32_t", 100, "data", {plain_execution, bulk_erase_execution}});
+
+  const auto json_report = _export(report);
+  ASSERT_EQ(json_report["cases"].size(), 1);
+  const auto& json_case = json_report["cases"][0];
+  EXPECT_EQ(json_case["case_name"], "BulkErase");
+  EXPECT_EQ(json_case["index_name"], "Sorted Vector");
+  EXPECT_EQ(json_case["data_size"], 100);
+  ASSERT_EQ(json_case["executions"].size(), 2);
+
+  // each execution is an object with its measurements, the optional fields are only written if they were recorded
+  const auto& plain_json_execution = json_case["executions"][0];
+  ASSERT_TRUE(plain_json_execution.is_object());
+  EXPECT_EQ(plain_json_execution.size(), 1);
+  ASSERT_EQ(plain_json_execution["measurements"].size(), 1);
+  EXPECT_EQ(plain_json_execution["measurements"][0]["duration_ns"], 500);
+  EXPECT_EQ(plain_json_execution["measurements"][0]["index_size_bytes"], 64);
+
+  const auto& bulk_erase_json_execution = json_case["executions"][1];
+  ASSERT_TRUE(bulk_erase_json_execution.is_object());
+  ASSERT_EQ(bulk_erase_json_execution["measurements"].size(), 1);
+  EXPECT_EQ(bulk_erase_json_execution["measurements"][0]["duration_ns"], 1'000);
+  EXPECT_EQ(bulk_erase_json_execution["measurements"][0]["operation_count"], 100);
+  EXPECT_DOUBLE_EQ(bulk_erase_json_execution["throughput_ops_per_s"].get<double>(), 1e8);
+  EXPECT_EQ(bulk_erase_json_execution["freed_bytes"], 16);
+  EXPECT_FALSE(bulk_erase_json_execution.contains("throughput_series"));
+}
+
+}  // namespace imib
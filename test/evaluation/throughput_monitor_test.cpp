@@ -0,0 +1,62 @@
+#include <chrono>
+
+#include "gtest/gtest.h"
+
+#include "evaluation/throughput_monitor.hpp"
+
+namespace imib {
+
+class ThroughputMonitorTest : public ::testing::Test {
+ protected:
+  static TimeBound _time_bound(const double target_relative_error) {
+    auto time_bound = TimeBound{};
+    time_bound.duration = std::chrono::milliseconds{2'000};
+    time_bound.warm_up = std::chrono::milliseconds{150};
+    time_bound.bucket_duration = std::chrono::milliseconds{100};
+    time_bound.target_relative_error = target_relative_error;
+    return time_bound;
+  }
+};
+
+TEST_F(ThroughputMonitorTest, Series) {
+  auto monitor = ThroughputMonitor{_time_bound(0.0)};
+  monitor.add(std::chrono::milliseconds{50}, 10);
+  monitor.add(std::chrono::milliseconds{150}, 20);
+  monitor.add(std::chrono::milliseconds{199}, 30);
+  monitor.add(std::chrono::milliseconds{210}, 5);
+  // after the end of the time bound
+  monitor.add(std::chrono::milliseconds{3'000}, 100);
+
+  // the last bucket is 25 ms long
+  const auto series = monitor.series(std::chrono::milliseconds{225});
+  EXPECT_EQ(series.bucket_duration, std::chrono::milliseconds{100});
+  // the second bucket contains the end of the warm-up
+  EXPECT_EQ(series.warm_up_bucket_count, 2);
+  ASSERT_EQ(series.operations_per_second.size(), 3);
+  EXPECT_DOUBLE_EQ(series.operations_per_second[0], 100.0);
+  EXPECT_DOUBLE_EQ(series.operations_per_second[1], 500.0);
+  EXPECT_DOUBLE_EQ(series.operations_per_second[2], 200.0);
+}
+
+TEST_F(ThroughputMonitorTest, Converged) {
+  auto steady_monitor = ThroughputMonitor{_time_bound(0.01)};
+  auto noisy_monitor = ThroughputMonitor{_time_bound(0.01)};
+  for (auto bucket = 0; bucket < 20; ++bucket) {
+    const auto elapsed = std::chrono::milliseconds{bucket * 100 + 50};
+    steady_monitor.add(elapsed, 1'000 + bucket % 2);
+    noisy_monitor.add(elapsed, bucket % 2 == 0 ? 100 : 1'000);
+  }
+  // the buckets after the warm-up that are complete after 1 s are too few
+  EXPECT_FALSE(steady_monitor.converged(std::chrono::milliseconds{1'000}));
+  EXPECT_TRUE(steady_monitor.converged(std::chrono::milliseconds{2'000}));
+  EXPECT_FALSE(noisy_monitor.converged(std::chrono::milliseconds{2'000}));
+
+  // without target, the whole duration is executed
+  auto monitor = ThroughputMonitor{_time_bound(0.0)};
+  for (auto bucket = 0; bucket < 20; ++bucket) {
+    monitor.add(std::chrono::milliseconds{bucket * 100 + 50}, 1'000);
+  }
+  EXPECT_FALSE(monitor.converged(std::chrono::milliseconds{2'000}));
+}
+
+}  // namespace imib
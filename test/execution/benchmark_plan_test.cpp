@@ -0,0 +1,190 @@
+#include <algorithm>
+#include <chrono>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "execution/benchmark_plan.hpp"
+
+namespace imib {
+
+class BenchmarkPlanTest : public ::testing::Test {};
+
+TEST_F(BenchmarkPlanTest, ParsePlan) {
+  const auto config = BenchmarkPlan::parse(R"({
+    "iterations": 3,
+    "threads": 2,
+    "key_types": ["uint32_t", "uint64_t"],
+    "datasets": [
+      {"data": "data_a", "equality_lookups": "data_a_eq", "range_lookups": "data_a_range"},
+      {"data": "data_b", "equality_lookups": "data_b_eq", "range_lookups": "data_b_range", "populate": true,
+       "huge_pages": true}
+    ],
+    "cases": [{"case": "RangeLookup", "indexes": ["TLX B+ Tree", "Masstree"]}, {"case": "Insert"}],
+    "result_file_prefix": "result",
+    "record_latencies": true,
+    "workload_mixes": [{"name": "ScanUpdate", "range_lookups": 80, "updates": 20}]
+  })");
+  EXPECT_EQ(config.iterations, 3);
+  EXPECT_EQ(config.threads, 2);
+  EXPECT_EQ(config.key_types, (std::vector<std::string>{"uint32_t", "uint64_t"}));
+  ASSERT_EQ(config.datasets.size(), 2);
+  EXPECT_EQ(config.datasets[1].data_file, "data_b");
+  EXPECT_EQ(config.datasets[1].equality_lookup_file, "data_b_eq");
+  EXPECT_EQ(config.datasets[1].range_lookup_file, "data_b_range");
+  EXPECT_FALSE(config.datasets[0].populate);
+  EXPECT_FALSE(config.datasets[0].huge_pages);
+  EXPECT_TRUE(config.datasets[1].populate);
+  EXPECT_TRUE(config.datasets[1].huge_pages);
+  ASSERT_EQ(config.cases.size(), 2);
+  EXPECT_EQ(config.cases[0].case_name, "RangeLookup");
+  EXPECT_EQ(config.cases[0].index_names, (std::vector<std::string>{"TLX B+ Tree", "Masstree"}));
+  EXPECT_EQ(config.cases[1].case_name, "Insert");
+  EXPECT_TRUE(config.cases[1].index_names.empty());
+  EXPECT_EQ(config.output_file_name, "result");
+  EXPECT_TRUE(config.record_latencies);
+  ASSERT_EQ(config.workload_mixes.size(), 1);
+  EXPECT_EQ(config.workload_mixes[0].name, "ScanUpdate");
+  EXPECT_EQ(config.workload_mixes[0].equality_lookups, 0);
+  EXPECT_EQ(config.workload_mixes[0].range_lookups, 80);
+  EXPECT_EQ(config.workload_mixes[0].inserts, 0);
+  EXPECT_EQ(config.workload_mixes[0].updates, 20);
+}
+
+TEST_F(BenchmarkPlanTest, ParsePlanWithDefaults) {
+  const auto config = BenchmarkPlan::parse(R"({
+    "key_types": ["uint64_t"],
+    "datasets": [{"data": "data", "equality_lookups": "data_eq", "range_lookups": "data_range"}]
+  })");
+  EXPECT_EQ(config.iterations, 1);
+  EXPECT_EQ(config.threads, 1);
+  EXPECT_EQ(config.cases.size(), BenchmarkPlan::default_cases().size());
+  EXPECT_TRUE(config.output_file_name.empty());
+  EXPECT_FALSE(config.record_latencies);
+  EXPECT_EQ(config.workload_mixes.size(), BenchmarkPlan::default_workload_mixes().size());
+  EXPECT_FALSE(config.time_bound.enabled());
+  EXPECT_DOUBLE_EQ(config.bulk_erase_fraction, 0.1);
+}
+
+TEST_F(BenchmarkPlanTest, DefaultCasesExecuteTheWorkloadMixes) {
+  const auto config = BenchmarkPlan::parse(R"({
+    "key_types": ["uint64_t"],
+    "datasets": [{"data": "data", "equality_lookups": "data_eq", "range_lookups": "data_range"}],
+    "workload_mixes": [{"name": "ReadUpdate", "equality_lookups": 80, "updates": 20},
+                       {"name": "ScanUpdate", "range_lookups": 80, "updates": 20}]
+  })");
+  const auto find_case = [&](const std::string& case_name) {
+    return std::find_if(config.cases.cbegin(), config.cases.cend(),
+                        [&](const CaseSelection& selection) { return selection.case_name == case_name; });
+  };
+  const auto read_update = find_case("MixedWorkload(ReadUpdate)");
+  ASSERT_NE(read_update, config.cases.cend());
+  EXPECT_EQ(read_update->index_names, (std::vector<std::string>{"OLC ART", "Open Bw-Tree", "Masstree",
+                                                                "Sharded RH Flat Map", "Sharded TSL Robin Map"}));
+  // the sharded hash maps have no range lookups
+  const auto scan_update = find_case("MixedWorkload(ScanUpdate)");
+  ASSERT_NE(scan_update, config.cases.cend());
+  EXPECT_EQ(scan_update->index_names, (std::vector<std::string>{"OLC ART", "Open Bw-Tree", "Masstree"}));
+
+  // the default mixes are selected by the default cases
+  const auto default_cases = BenchmarkPlan::default_cases();
+  for (const auto& mix : BenchmarkPlan::default_workload_mixes()) {
+    EXPECT_TRUE(std::any_of(default_cases.cbegin(), default_cases.cend(), [&](const CaseSelection& selection) {
+      return selection.case_name == "MixedWorkload(" + mix.name + ")";
+    })) << mix.name;
+  }
+}
+
+TEST_F(BenchmarkPlanTest, ParseGeneratedDataset) {
+  const auto config = BenchmarkPlan::parse(R"({
+    "key_types": ["uint64_t"],
+    "datasets": [{
+      "data": {"distribution": "uniform", "count": 1000, "seed": 1, "distinct_count": 100},
+      "equality_lookups": {"distribution": "zipfian", "count": 500, "skew": 1.2, "seed": 2},
+      "range_lookups": {"distribution": "hotspot", "count": 50, "hot_probability": 0.9, "hot_fraction": 0.05,
+                        "range_size": 20}
+    }]
+  })");
+  ASSERT_EQ(config.datasets.size(), 1);
+  const auto& dataset = config.datasets[0];
+  EXPECT_TRUE(dataset.data_file.empty());
+  EXPECT_EQ(dataset.key_distribution.type, DistributionType::Uniform);
+  EXPECT_EQ(dataset.key_distribution.count, 1000);
+  EXPECT_EQ(dataset.key_distribution.seed, 1);
+  EXPECT_EQ(dataset.key_distribution.distinct_count, 100);
+  EXPECT_TRUE(dataset.equality_lookup_file.empty());
+  EXPECT_EQ(dataset.equality_lookup_distribution.type, DistributionType::Zipfian);
+  EXPECT_EQ(dataset.equality_lookup_distribution.count, 500);
+  EXPECT_DOUBLE_EQ(dataset.equality_lookup_distribution.skew, 1.2);
+  EXPECT_EQ(dataset.equality_lookup_distribution.seed, 2);
+  EXPECT_EQ(dataset.equality_lookup_distribution.distinct_count, 0);
+  EXPECT_TRUE(dataset.range_lookup_file.empty());
+  EXPECT_EQ(dataset.range_lookup_distribution.type, DistributionType::Hotspot);
+  EXPECT_DOUBLE_EQ(dataset.range_lookup_distribution.hot_probability, 0.9);
+  EXPECT_DOUBLE_EQ(dataset.range_lookup_distribution.hot_fraction, 0.05);
+  EXPECT_EQ(dataset.range_lookup_size, 20);
+
+  EXPECT_THROW(BenchmarkPlan::parse(R"({"key_types": ["uint64_t"], "datasets": [{"data": {"distribution": "pareto",
+               "count": 10}, "equality_lookups": "eq", "range_lookups": "range"}]})"),
+               std::logic_error);
+  EXPECT_THROW(BenchmarkPlan::parse(R"({"key_types": ["uint64_t"], "datasets": [{"data": {"distribution": "uniform"},
+               "equality_lookups": "eq", "range_lookups": "range"}]})"),
+               std::logic_error);
+}
+
+TEST_F(BenchmarkPlanTest, MissingFields) {
+  EXPECT_THROW(BenchmarkPlan::parse(R"({"datasets": []})"), std::logic_error);
+  EXPECT_THROW(BenchmarkPlan::parse(R"({"key_types": ["uint64_t"]})"), std::logic_error);
+  EXPECT_THROW(BenchmarkPlan::parse(R"({"key_types": ["uint64_t"], "datasets": [{"data": "data"}]})"),
+               std::logic_error);
+  EXPECT_THROW(BenchmarkPlan::parse(R"({"key_types": ["uint64_t"], "datasets": [], "cases": [{"indexes": []}]})"),
+               std::logic_error);
+}
+
+TEST_F(BenchmarkPlanTest, InvalidWorkloadMixes) {
+  const auto plan = [](const std::string& workload_mixes) {
+    return R"({"key_types": ["uint64_t"], "datasets": [], "workload_mixes": )" + workload_mixes + "}";
+  };
+  EXPECT_THROW(BenchmarkPlan::parse(plan(R"([{"equality_lookups": 100}])")), std::logic_error);
+  EXPECT_THROW(BenchmarkPlan::parse(plan(R"([{"name": "Empty"}])")), std::logic_error);
+  EXPECT_THROW(BenchmarkPlan::parse(plan(R"([{"name": "Mix", "inserts": 1}, {"name": "Mix", "updates": 1}])")),
+               std::logic_error);
+}
+
+TEST_F(BenchmarkPlanTest, ParseTimeBound) {
+  const auto plan = [](const std::string& time_bound) {
+    return R"({"key_types": ["uint64_t"], "datasets": [], "time_bound": )" + time_bound + "}";
+  };
+  const auto config =
+      BenchmarkPlan::parse(plan(R"({"duration_ms": 5000, "warm_up_ms": 500, "target_relative_error": 0.02})"));
+  EXPECT_TRUE(config.time_bound.enabled());
+  EXPECT_EQ(config.time_bound.duration, std::chrono::milliseconds{5'000});
+  EXPECT_EQ(config.time_bound.warm_up, std::chrono::milliseconds{500});
+  EXPECT_EQ(config.time_bound.bucket_duration, std::chrono::milliseconds{100});
+  EXPECT_DOUBLE_EQ(config.time_bound.target_relative_error, 0.02);
+
+  EXPECT_THROW(BenchmarkPlan::parse(plan(R"({"warm_up_ms": 500})")), std::logic_error);
+  EXPECT_THROW(BenchmarkPlan::parse(plan(R"({"duration_ms": 0})")), std::logic_error);
+  EXPECT_THROW(BenchmarkPlan::parse(plan(R"({"duration_ms": 1000, "bucket_ms": 0})")), std::logic_error);
+  EXPECT_THROW(BenchmarkPlan::parse(plan(R"({"duration_ms": 1000, "warm_up_ms": -1})")), std::logic_error);
+  EXPECT_THROW(BenchmarkPlan::parse(plan(R"({"duration_ms": 1000, "target_relative_error": -0.1})")),
+               std::logic_error);
+}
+
+TEST_F(BenchmarkPlanTest, ParseBulkEraseFraction) {
+  const auto plan = [](const std::string& fraction) {
+    return R"({"key_types": ["uint64_t"], "datasets": [], "bulk_erase_fraction": )" + fraction + "}";
+  };
+  EXPECT_DOUBLE_EQ(BenchmarkPlan::parse(plan("0.5")).bulk_erase_fraction, 0.5);
+  EXPECT_DOUBLE_EQ(BenchmarkPlan::parse(plan("1")).bulk_erase_fraction, 1.0);
+  EXPECT_THROW(BenchmarkPlan::parse(plan("0")), std::logic_error);
+  EXPECT_THROW(BenchmarkPlan::parse(plan("1.5")), std::logic_error);
+}
+
+TEST_F(BenchmarkPlanTest, MissingPlanFile) {
+  EXPECT_THROW(BenchmarkPlan::load("missing_benchmark_plan.json"), std::logic_error);
+}
+
+}  // namespace imib
@@ -0,0 +1,119 @@
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "execution/benchmark_plan.hpp"
+#include "execution/benchmark_registry.hpp"
+
+namespace imib {
+
+class BenchmarkRegistryTest : public ::testing::Test {
+ protected:
+  // returns the names of the indexes for which the case is registered
+  template <typename Key>
+  static std::vector<std::string> _index_names(const std::string& case_name,
+                                               const Data<Key, uint64_t>& data = Data<Key, uint64_t>{}) {
+    const auto equality_lookups = std::vector<EqualityLookup<Key>>{};
+    const auto range_lookups = std::vector<RangeLookup<Key>>{};
+    auto index_names = std::vector<std::string>{};
+    for (const auto& bench_case :
+         BenchmarkRegistry<Key, uint64_t>::create_cases(data, equality_lookups, range_lookups,
+                                                        BenchmarkPlan::default_workload_mixes(), 0.1)) {
+      if (bench_case->name() == case_name) {
+        index_names.push_back(bench_case->index_name());
+      }
+    }
+    std::sort(index_names.begin(), index_names.end());
+    return index_names;
+  }
+
+  static bool _contains(const std::vector<std::string>& names, const std::string& name) {
+    return std::find(names.cbegin(), names.cend(), name) != names.cend();
+  }
+};
+
+TEST_F(BenchmarkRegistryTest, OnlyIndexesThatSupportTheOperation) {
+  const auto range_lookup_indexes = _index_names<uint64_t>("RangeLookup");
+  EXPECT_TRUE(_contains(range_lookup_indexes, "TLX B+ Tree"));
+  EXPECT_FALSE(_contains(range_lookup_indexes, "RH Flat Map"));
+  EXPECT_EQ(_index_names<uint64_t>("BatchedEqualityLookup"),
+            (std::vector<std::string>{"Eytzinger Array", "STD Hash Map", "Sharded RH Flat Map",
+                                      "Sharded TSL Robin Map", "Sorted Vector"}));
+}
+
+TEST_F(BenchmarkRegistryTest, MixedWorkloadOnlyForIndexesThatSupportAllOperations) {
+  const auto read_mostly_indexes = _index_names<uint64_t>("MixedWorkload(ReadMostly)");
+  EXPECT_TRUE(_contains(read_mostly_indexes, "RH Flat Map"));
+  EXPECT_TRUE(_contains(read_mostly_indexes, "TLX B+ Tree"));
+  const auto scan_insert_indexes = _index_names<uint64_t>("MixedWorkload(ScanInsert)");
+  EXPECT_TRUE(_contains(scan_insert_indexes, "TLX B+ Tree"));
+  EXPECT_FALSE(_contains(scan_insert_indexes, "RH Flat Map"));
+}
+
+TEST_F(BenchmarkRegistryTest, JudyOnlyWithUInt64Keys) {
+  EXPECT_TRUE(_contains(_index_names<uint64_t>("EqualityLookup"), "MP Judy"));
+  EXPECT_FALSE(_contains(_index_names<uint32_t>("EqualityLookup"), "MP Judy"));
+}
+
+TEST_F(BenchmarkRegistryTest, OnlyDuplicateCapableIndexesForDuplicateKeys) {
+  const auto data = Data<uint64_t, uint64_t>{{}, {}, {{1, 1}, {1, 2}, {2, 3}}, {}};
+  const auto equality_lookup_indexes = _index_names<uint64_t>("EqualityLookup", data);
+  EXPECT_TRUE(_contains(equality_lookup_indexes, "TLX B+ Tree Multimap"));
+  EXPECT_TRUE(_contains(equality_lookup_indexes, "Sorted Vector"));
+  EXPECT_FALSE(_contains(equality_lookup_indexes, "TLX B+ Tree"));
+  EXPECT_FALSE(_contains(equality_lookup_indexes, "RH Flat Map"));
+  EXPECT_TRUE(_contains(_index_names<uint64_t>("EqualityLookup"), "TLX B+ Tree"));
+
+  const auto duplicate_lookup_indexes = _index_names<uint64_t>("DuplicateEqualityLookup", data);
+  EXPECT_TRUE(_contains(duplicate_lookup_indexes, "RH Posting List Map"));
+  EXPECT_TRUE(_contains(duplicate_lookup_indexes, "Unsync ART Posting List"));
+  EXPECT_FALSE(_contains(duplicate_lookup_indexes, "RH Flat Map"));
+}
+
+TEST_F(BenchmarkRegistryTest, OnlyCasesThatPassTheFilter) {
+  const auto data = Data<uint64_t, uint64_t>{{}, {}, {{1, 1}, {2, 2}}, {}};
+  const auto equality_lookups = std::vector<EqualityLookup<uint64_t>>{};
+  const auto range_lookups = std::vector<RangeLookup<uint64_t>>{};
+  const auto cases = BenchmarkRegistry<uint64_t, uint64_t>::create_cases(
+      data, equality_lookups, range_lookups, BenchmarkPlan::default_workload_mixes(), 0.1,
+      [](const BaseBenchmarkCase& bench_case) { return bench_case.index_type() == IndexType::BTreeTLX; });
+  ASSERT_FALSE(cases.empty());
+  for (const auto& bench_case : cases) {
+    EXPECT_EQ(bench_case->index_name(), "TLX B+ Tree");
+  }
+}
+
+TEST_F(BenchmarkRegistryTest, StringKeysOnlyForStringCapableIndexes) {
+  const auto equality_lookup_indexes = _index_names<std::string_view>("EqualityLookup");
+  EXPECT_TRUE(_contains(equality_lookup_indexes, "Unsync ART"));
+  EXPECT_TRUE(_contains(equality_lookup_indexes, "TLX B+ Tree"));
+  EXPECT_TRUE(_contains(equality_lookup_indexes, "RH Flat Map"));
+  EXPECT_FALSE(_contains(equality_lookup_indexes, "SIMD Sorted Vector"));
+  EXPECT_FALSE(_contains(equality_lookup_indexes, "MP Judy"));
+  EXPECT_TRUE(_contains(_index_names<std::string_view>("RangeLookup"), "Abseil B-Tree"));
+}
+
+TEST_F(BenchmarkRegistryTest, BulkEraseOnlyForIndexesWithBulkErase) {
+  const auto bulk_erase_indexes = _index_names<uint64_t>("BulkErase");
+  EXPECT_TRUE(_contains(bulk_erase_indexes, "Abseil B-Tree"));
+  EXPECT_TRUE(_contains(bulk_erase_indexes, "Sorted Vector"));
+  EXPECT_TRUE(_contains(bulk_erase_indexes, "RH Flat Map"));
+  EXPECT_FALSE(_contains(bulk_erase_indexes, "Sharded RH Flat Map"));
+  EXPECT_FALSE(_contains(bulk_erase_indexes, "OLC ART"));
+}
+
+TEST_F(BenchmarkRegistryTest, DefaultCasesAreRegistered) {
+  for (const auto& selection : BenchmarkPlan::default_cases()) {
+    const auto index_names = _index_names<uint64_t>(selection.case_name);
+    EXPECT_FALSE(index_names.empty()) << selection.case_name;
+    for (const auto& index_name : selection.index_names) {
+      EXPECT_TRUE(_contains(index_names, index_name)) << selection.case_name << ", " << index_name;
+    }
+  }
+}
+
+}  // namespace imib
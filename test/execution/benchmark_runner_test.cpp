@@ -0,0 +1,131 @@
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "execution/benchmark_runner.hpp"
+
+namespace imib {
+
+class BenchmarkRunnerTest : public ::testing::Test {
+ protected:
+  static BenchmarkConfiguration _configuration(const std::vector<CaseSelection>& cases) {
+    return BenchmarkConfiguration{1, 1, {"uint32_t"}, {}, cases, ""};
+  }
+};
+
+// the configuration is validated before any data is generated, thus, the configurations do not need datasets
+TEST_F(BenchmarkRunnerTest, RejectsUnknownNames) {
+  EXPECT_THROW(BenchmarkRunner(_configuration({{"UnknownCase", {}}})).run(), std::logic_error);
+  EXPECT_THROW(BenchmarkRunner(_configuration({{"RangeLookup", {"Unknown Index"}}})).run(), std::logic_error);
+  EXPECT_THROW(BenchmarkRunner(_configuration({{"RangeLookup", {"RH Flat Map"}}})).run(), std::logic_error);
+  auto unsupported_key_type = _configuration({{"RangeLookup", {}}});
+  unsupported_key_type.key_types = {"float"};
+  EXPECT_THROW(BenchmarkRunner(unsupported_key_type).run(), std::logic_error);
+}
+
+TEST_F(BenchmarkRunnerTest, ExecutesSelectedCases) {
+  auto config = _configuration({{"RangeLookup", {"TLX B+ Tree", "Sorted Vector"}}});
+  const auto data_file = std::string{"../resources/test_data/books_10K_uint32"};
+  config.datasets = {{data_file, data_file + "_equality_lookups", data_file + "_range_lookups"}};
+  config.record_latencies = true;
+  auto runner = BenchmarkRunner(config);
+  testing::internal::CaptureStdout();
+  runner.run();
+  const auto output = testing::internal::GetCapturedStdout();
+  EXPECT_NE(output.find("Run RangeLookup, TLX B+ Tree"), std::string::npos);
+  EXPECT_NE(output.find("Run RangeLookup, Sorted Vector"), std::string::npos);
+  EXPECT_EQ(output.find("Run RangeLookup, Masstree"), std::string::npos);
+  EXPECT_NE(output.find("latencies: p50: "), std::string::npos);
+}
+
+TEST_F(BenchmarkRunnerTest, ExecutesMixedWorkload) {
+  auto config = _configuration({{"MixedWorkload(ReadInsert)", {"TLX B+ Tree"}}});
+  const auto data_file = std::string{"../resources/test_data/books_10K_uint32"};
+  config.datasets = {{data_file, data_file + "_equality_lookups", data_file + "_range_lookups"}};
+  config.record_latencies = true;
+  config.workload_mixes = {{"ReadInsert", 95, 0, 5, 0}};
+  auto runner = BenchmarkRunner(config);
+  testing::internal::CaptureStdout();
+  runner.run();
+  const auto output = testing::internal::GetCapturedStdout();
+  EXPECT_NE(output.find("Run MixedWorkload(ReadInsert), TLX B+ Tree"), std::string::npos);
+  EXPECT_NE(output.find("throughput: "), std::string::npos);
+  EXPECT_NE(output.find("EqualityLookup latencies: p50: "), std::string::npos);
+  EXPECT_NE(output.find("Insert latencies: p50: "), std::string::npos);
+}
+
+TEST_F(BenchmarkRunnerTest, ExecutesGeneratedDataset) {
+  auto config = _configuration({{"EqualityLookup", {"Sorted Vector"}}, {"RangeLookup", {"Sorted Vector"}}});
+  auto dataset = DatasetConfiguration{};
+  dataset.key_distribution = KeyDistribution{DistributionType::Uniform, 1, 1'000};
+  dataset.equality_lookup_distribution = KeyDistribution{DistributionType::Zipfian, 2, 1'000};
+  dataset.range_lookup_distribution = KeyDistribution{DistributionType::Hotspot, 3, 100};
+  config.datasets = {dataset};
+  auto runner = BenchmarkRunner(config);
+  testing::internal::CaptureStdout();
+  runner.run();
+  const auto output = testing::internal::GetCapturedStdout();
+  EXPECT_NE(output.find("Generate data: uniform(count=1000, seed=1)"), std::string::npos);
+  EXPECT_NE(output.find("Run EqualityLookup, Sorted Vector"), std::string::npos);
+  EXPECT_NE(output.find("Run RangeLookup, Sorted Vector"), std::string::npos);
+}
+
+TEST_F(BenchmarkRunnerTest, ExecutesBulkErase) {
+  auto config = _configuration({{"BulkErase", {"TLX B+ Tree", "Sorted Vector", "RH Flat Map"}}});
+  auto dataset = DatasetConfiguration{};
+  dataset.key_distribution = KeyDistribution{DistributionType::Uniform, 1, 1'000};
+  dataset.equality_lookup_distribution = KeyDistribution{DistributionType::Uniform, 2, 100};
+  dataset.range_lookup_distribution = KeyDistribution{DistributionType::Uniform, 3, 100};
+  config.datasets = {dataset};
+  config.bulk_erase_fraction = 0.5;
+  auto runner = BenchmarkRunner(config);
+  testing::internal::CaptureStdout();
+  runner.run();
+  const auto output = testing::internal::GetCapturedStdout();
+  EXPECT_NE(output.find("Run BulkErase, TLX B+ Tree"), std::string::npos);
+  EXPECT_NE(output.find("Run BulkErase, Sorted Vector"), std::string::npos);
+  EXPECT_NE(output.find("Run BulkErase, RH Flat Map"), std::string::npos);
+}
+
+TEST_F(BenchmarkRunnerTest, ExecutesDuplicateDataset) {
+  // indexes that require unique keys are skipped for a dataset with duplicate keys
+  auto config = _configuration({{"EqualityLookup", {"TLX B+ Tree Multimap", "TLX B+ Tree"}},
+                                {"DuplicateEqualityLookup", {"RH Posting List Map"}}});
+  auto dataset = DatasetConfiguration{};
+  dataset.key_distribution = KeyDistribution{DistributionType::Zipfian, 1, 1'000};
+  dataset.key_distribution.distinct_count = 10;
+  dataset.equality_lookup_distribution = KeyDistribution{DistributionType::Uniform, 2, 100};
+  dataset.range_lookup_distribution = KeyDistribution{DistributionType::Uniform, 3, 100};
+  config.datasets = {dataset};
+  auto runner = BenchmarkRunner(config);
+  testing::internal::CaptureStdout();
+  runner.run();
+  const auto output = testing::internal::GetCapturedStdout();
+  EXPECT_NE(output.find("Run EqualityLookup, TLX B+ Tree Multimap"), std::string::npos);
+  EXPECT_EQ(output.find("Run EqualityLookup, TLX B+ Tree,"), std::string::npos);
+  EXPECT_NE(output.find("Run DuplicateEqualityLookup, RH Posting List Map"), std::string::npos);
+  EXPECT_NE(output.find("result count: "), std::string::npos);
+}
+
+TEST_F(BenchmarkRunnerTest, ExecutesStringDatasets) {
+  auto config = _configuration({{"EqualityLookup", {"Unsync ART", "TLX B+ Tree"}}, {"RangeLookup", {"TLX B+ Tree"}}});
+  config.key_types = {"string"};
+  const auto data_file = std::string{"../resources/test_data/emails_1K_string"};
+  auto generated_dataset = DatasetConfiguration{};
+  generated_dataset.key_distribution = KeyDistribution{DistributionType::Uniform, 1, 1'000};
+  generated_dataset.equality_lookup_distribution = KeyDistribution{DistributionType::Zipfian, 2, 1'000};
+  generated_dataset.range_lookup_distribution = KeyDistribution{DistributionType::Uniform, 3, 100};
+  config.datasets = {{data_file, data_file + "_equality_lookups", data_file + "_range_lookups"}, generated_dataset};
+  auto runner = BenchmarkRunner(config);
+  testing::internal::CaptureStdout();
+  runner.run();
+  const auto output = testing::internal::GetCapturedStdout();
+  EXPECT_NE(output.find("Generate data: ../resources/test_data/emails_1K_string, key type: string"), std::string::npos);
+  EXPECT_NE(output.find("Generate data: uniform(count=1000, seed=1), key type: string"), std::string::npos);
+  EXPECT_NE(output.find("Run EqualityLookup, Unsync ART, key type: string"), std::string::npos);
+  EXPECT_NE(output.find("Run RangeLookup, TLX B+ Tree, key type: string"), std::string::npos);
+}
+
+}  // namespace imib
@@ -0,0 +1,119 @@
+#include <atomic>
+#include <chrono>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "execution/parallel_executor.hpp"
+
+namespace imib {
+
+class ParallelExecutorTest : public ::testing::Test {};
+
+TEST_F(ParallelExecutorTest, PartitionCoversAllItems) {
+  const auto thread_count = size_t{3};
+  const auto item_count = size_t{10};
+  // the first thread processes one more item than the remaining threads
+  EXPECT_EQ(ParallelExecutor::partition(thread_count, item_count, 0), (std::pair<size_t, size_t>{0, 4}));
+  EXPECT_EQ(ParallelExecutor::partition(thread_count, item_count, 1), (std::pair<size_t, size_t>{4, 7}));
+  EXPECT_EQ(ParallelExecutor::partition(thread_count, item_count, 2), (std::pair<size_t, size_t>{7, 10}));
+}
+
+TEST_F(ParallelExecutorTest, PartitionWithMoreThreadsThanItems) {
+  EXPECT_EQ(ParallelExecutor::partition(4, 2, 0), (std::pair<size_t, size_t>{0, 1}));
+  EXPECT_EQ(ParallelExecutor::partition(4, 2, 1), (std::pair<size_t, size_t>{1, 2}));
+  EXPECT_EQ(ParallelExecutor::partition(4, 2, 2), (std::pair<size_t, size_t>{2, 2}));
+  EXPECT_EQ(ParallelExecutor::partition(4, 2, 3), (std::pair<size_t, size_t>{2, 2}));
+}
+
+TEST_F(ParallelExecutorTest, EachItemIsProcessedOnce) {
+  for (const auto thread_count : {size_t{1}, size_t{2}, size_t{7}}) {
+    auto processed = std::vector<std::atomic<uint32_t>>(1000);
+    const auto durations =
+        ParallelExecutor::execute(thread_count, processed.size(), [&](const size_t begin, const size_t end) {
+          for (auto item = begin; item < end; ++item) {
+            ++processed[item];
+          }
+        });
+    EXPECT_EQ(durations.size(), thread_count);
+    for (const auto& counter : processed) {
+      ASSERT_EQ(counter.load(), 1u);
+    }
+  }
+}
+
+// each thread records the latencies of its items, which are merged into one histogram
+TEST_F(ParallelExecutorTest, RecordLatencies) {
+  for (const auto record_latencies : {false, true}) {
+    auto latencies = LatencyHistogram{};
+    ParallelExecutor::execute(3, 1000, record_latencies, latencies,
+                              [&](const size_t begin, const size_t end, LatencyRecorder& recorder) {
+                                for (auto item = begin; item < end; ++item) {
+                                  const auto start_ticks = recorder.start();
+                                  recorder.stop(start_ticks);
+                                }
+                              });
+    EXPECT_EQ(latencies.count(), record_latencies ? 1000 : 0);
+  }
+}
+
+// the lookups are repeated until the time is over, the warm-up is neither measured nor recorded
+TEST_F(ParallelExecutorTest, TimeBoundedRepeatable) {
+  auto time_bound = TimeBound{};
+  time_bound.duration = std::chrono::milliseconds{200};
+  time_bound.warm_up = std::chrono::milliseconds{50};
+  time_bound.bucket_duration = std::chrono::milliseconds{10};
+  auto latencies = LatencyHistogram{};
+  auto throughput_series = ThroughputSeries{};
+  auto executed_count = std::atomic<size_t>{0};
+  const auto measurements = ParallelExecutor::execute(
+      2, 100, true, time_bound, true, latencies, throughput_series,
+      [&](const size_t begin, const size_t end, LatencyRecorder& recorder) {
+        for (auto item = begin; item < end; ++item) {
+          const auto start_ticks = recorder.start();
+          ++executed_count;
+          recorder.stop(start_ticks);
+        }
+      });
+  ASSERT_EQ(measurements.size(), 2);
+  auto measured_count = size_t{0};
+  for (const auto& measurement : measurements) {
+    measured_count += measurement.operation_count;
+    EXPECT_GE(measurement.duration, std::chrono::milliseconds{150});
+  }
+  // each item was executed multiple times
+  EXPECT_GT(measured_count, 100);
+  EXPECT_LT(measured_count, executed_count.load());
+  EXPECT_EQ(latencies.count(), measured_count);
+  EXPECT_EQ(throughput_series.bucket_duration, std::chrono::milliseconds{10});
+  EXPECT_EQ(throughput_series.warm_up_bucket_count, 5);
+  EXPECT_GE(throughput_series.operations_per_second.size(), 25);
+}
+
+// the inserts stop after the last item, even if the time is not over
+TEST_F(ParallelExecutorTest, TimeBoundedNotRepeatable) {
+  auto time_bound = TimeBound{};
+  time_bound.duration = std::chrono::milliseconds{10'000};
+  auto latencies = LatencyHistogram{};
+  auto throughput_series = ThroughputSeries{};
+  auto processed = std::vector<std::atomic<uint32_t>>(1000);
+  const auto measurements = ParallelExecutor::execute(
+      3, processed.size(), false, time_bound, false, latencies, throughput_series,
+      [&](const size_t begin, const size_t end, LatencyRecorder&) {
+        for (auto item = begin; item < end; ++item) {
+          ++processed[item];
+        }
+      });
+  for (const auto& counter : processed) {
+    ASSERT_EQ(counter.load(), 1u);
+  }
+  auto measured_count = size_t{0};
+  for (const auto& measurement : measurements) {
+    measured_count += measurement.operation_count;
+  }
+  EXPECT_EQ(measured_count, 1000);
+  EXPECT_LT(measurements[0].duration, std::chrono::seconds{10});
+  EXPECT_FALSE(throughput_series.operations_per_second.empty());
+}
+
+}  // namespace imib
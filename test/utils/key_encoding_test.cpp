@@ -0,0 +1,95 @@
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "utils/key_encoding.hpp"
+
+namespace imib {
+
+template <typename Key>
+class KeyEncodingTest : public ::testing::Test {
+ protected:
+  // the extreme values, zero, and random keys
+  static std::vector<Key> _keys() {
+    auto keys = std::vector<Key>{std::numeric_limits<Key>::lowest(), std::numeric_limits<Key>::max(), Key{0}, Key{1}};
+    if constexpr (std::is_floating_point_v<Key>) {
+      keys.insert(keys.end(), {Key{-0.5}, Key{0.5}, -std::numeric_limits<Key>::infinity(),
+                               std::numeric_limits<Key>::infinity(), std::numeric_limits<Key>::denorm_min()});
+    }
+    auto random_engine = std::mt19937_64{42};
+    for (size_t key_index = 0; key_index < 1'000; ++key_index) {
+      if constexpr (std::is_floating_point_v<Key>) {
+        keys.push_back(static_cast<Key>(std::uniform_real_distribution<double>{-1e9, 1e9}(random_engine)));
+      } else {
+        keys.push_back(static_cast<Key>(random_engine()));
+      }
+    }
+    return keys;
+  }
+
+  static std::vector<uint8_t> _encode(const Key& key) {
+    auto key_bytes = std::vector<uint8_t>(KeyEncoding::size(key));
+    KeyEncoding::encode(key, key_bytes.data());
+    return key_bytes;
+  }
+};
+
+using KeyTypes = ::testing::Types<uint32_t, uint64_t, int32_t, int64_t, float, double>;
+TYPED_TEST_SUITE(KeyEncodingTest, KeyTypes);
+
+TYPED_TEST(KeyEncodingTest, PreservesOrder) {
+  const auto keys = TestFixture::_keys();
+  for (size_t key_index = 1; key_index < keys.size(); ++key_index) {
+    const auto first = TestFixture::_encode(keys[key_index - 1]);
+    const auto second = TestFixture::_encode(keys[key_index]);
+    const auto comparison = std::memcmp(first.data(), second.data(), sizeof(TypeParam));
+    EXPECT_EQ(comparison < 0, keys[key_index - 1] < keys[key_index]);
+    EXPECT_EQ(comparison > 0, keys[key_index - 1] > keys[key_index]);
+  }
+}
+
+TYPED_TEST(KeyEncodingTest, SortsLikeKeys) {
+  auto keys = TestFixture::_keys();
+  auto encoded_keys = std::vector<std::vector<uint8_t>>{};
+  for (const auto& key : keys) {
+    encoded_keys.push_back(TestFixture::_encode(key));
+  }
+  std::sort(keys.begin(), keys.end());
+  std::sort(encoded_keys.begin(), encoded_keys.end());
+  for (size_t key_index = 0; key_index < keys.size(); ++key_index) {
+    EXPECT_EQ(KeyEncoding::decode<TypeParam>(encoded_keys[key_index].data()), keys[key_index]);
+  }
+}
+
+TEST(KeyEncodingStringTest, PreservesOrder) {
+  auto strings = std::vector<std::string>{"", "a", "ab", "abc", "b", "user1", "user10", "user2", "\x7f", "\xff"};
+  auto encoded_keys = std::vector<std::vector<uint8_t>>{};
+  for (const auto& string : strings) {
+    const auto key = std::string_view{string};
+    ASSERT_EQ(KeyEncoding::size(key), key.size() + 1);
+    auto key_bytes = std::vector<uint8_t>(KeyEncoding::size(key));
+    KeyEncoding::encode(key, key_bytes.data());
+    EXPECT_EQ(key_bytes.back(), 0);
+    encoded_keys.push_back(key_bytes);
+  }
+  // the strings are ordered by their unsigned bytes, and a prefix is ordered before the longer strings
+  EXPECT_TRUE(std::is_sorted(encoded_keys.cbegin(), encoded_keys.cend()));
+}
+
+TEST(KeyEncodingByteOrderTest, BigEndian) {
+  auto key_bytes = std::vector<uint8_t>(4);
+  KeyEncoding::encode(uint32_t{0x01020304}, key_bytes.data());
+  EXPECT_EQ(key_bytes, (std::vector<uint8_t>{1, 2, 3, 4}));
+  KeyEncoding::encode(int32_t{-1}, key_bytes.data());
+  EXPECT_EQ(key_bytes, (std::vector<uint8_t>{0x7f, 0xff, 0xff, 0xff}));
+}
+
+}  // namespace imib
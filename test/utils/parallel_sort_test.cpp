@@ -0,0 +1,132 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "utils/parallel_sort.hpp"
+
+namespace imib {
+
+template <typename Key>
+class ParallelSortTest : public ::testing::Test {
+ protected:
+  // enough entries to sort them with multiple threads, the keys are drawn from the given range
+  static std::vector<std::pair<Key, uint64_t>> _entries(const uint64_t max_key) {
+    auto random_engine = std::mt19937_64{42};
+    auto key_distribution = std::uniform_int_distribution<uint64_t>{0, max_key};
+    auto entries = std::vector<std::pair<Key, uint64_t>>{};
+    for (uint64_t value = 1; value <= 200'000; ++value) {
+      entries.emplace_back(static_cast<Key>(key_distribution(random_engine)), value);
+    }
+    // the values of equal keys are not in ascending order
+    std::shuffle(entries.begin(), entries.end(), random_engine);
+    return entries;
+  }
+
+  // the machine may have a single core, thus, the thread counts are given
+  static void _expect_sorted(const std::vector<std::pair<Key, uint64_t>>& entries) {
+    auto expected_entries = entries;
+    std::sort(expected_entries.begin(), expected_entries.end());
+    for (const auto thread_count : {size_t{1}, size_t{2}, size_t{7}}) {
+      auto sorted_entries = entries;
+      ParallelSort::sort(sorted_entries, thread_count);
+      EXPECT_EQ(sorted_entries, expected_entries) << thread_count << " threads";
+    }
+    auto sorted_entries = entries;
+    ParallelSort::sort(sorted_entries);
+    EXPECT_EQ(sorted_entries, expected_entries);
+  }
+
+  // the entries are split at the given position, both parts are sorted and then merged
+  static void _expect_merged(const std::vector<std::pair<Key, uint64_t>>& entries, const size_t middle) {
+    auto expected_entries = entries;
+    std::sort(expected_entries.begin(), expected_entries.end());
+    auto split_entries = entries;
+    std::sort(split_entries.begin(), split_entries.begin() + middle);
+    std::sort(split_entries.begin() + middle, split_entries.end());
+    for (const auto thread_count : {size_t{1}, size_t{2}, size_t{7}}) {
+      auto merged_entries = split_entries;
+      ParallelSort::merge(merged_entries, middle, thread_count);
+      EXPECT_EQ(merged_entries, expected_entries) << thread_count << " threads";
+    }
+  }
+};
+
+using KeyTypes = ::testing::Types<uint32_t, uint64_t>;
+TYPED_TEST_SUITE(ParallelSortTest, KeyTypes);
+
+TYPED_TEST(ParallelSortTest, SortsWholeKeyDomain) {
+  TestFixture::_expect_sorted(TestFixture::_entries(std::numeric_limits<TypeParam>::max()));
+}
+
+TYPED_TEST(ParallelSortTest, SortsDenseKeys) { TestFixture::_expect_sorted(TestFixture::_entries(300'000)); }
+
+TYPED_TEST(ParallelSortTest, SortsKeyDuplicatesByValue) { TestFixture::_expect_sorted(TestFixture::_entries(100)); }
+
+TYPED_TEST(ParallelSortTest, SortsSmallInputs) {
+  TestFixture::_expect_sorted({});
+  TestFixture::_expect_sorted({{3, 1}, {1, 3}, {2, 2}, {1, 1}});
+}
+
+TYPED_TEST(ParallelSortTest, MergesSortedRanges) {
+  const auto entries = TestFixture::_entries(std::numeric_limits<TypeParam>::max());
+  for (const auto middle : {size_t{0}, size_t{1}, size_t{1'000}, entries.size() / 2, entries.size()}) {
+    TestFixture::_expect_merged(entries, middle);
+  }
+  // the equal keys of both ranges are interleaved
+  TestFixture::_expect_merged(TestFixture::_entries(100), 123'457);
+}
+
+TEST(ParallelSortStringTest, SortsStrings) {
+  auto random_engine = std::mt19937_64{7};
+  auto strings = std::vector<std::string>{};
+  for (size_t string_index = 0; string_index < 100'000; ++string_index) {
+    strings.push_back("user" + std::to_string(random_engine() % 50'000));
+  }
+  auto entries = std::vector<std::pair<std::string_view, uint64_t>>{};
+  for (size_t position = 0; position < strings.size(); ++position) {
+    entries.emplace_back(strings[position], position + 1);
+  }
+  auto expected_entries = entries;
+  std::sort(expected_entries.begin(), expected_entries.end());
+  for (const auto thread_count : {size_t{2}, size_t{3}, size_t{8}}) {
+    auto sorted_entries = entries;
+    ParallelSort::sort(sorted_entries, thread_count);
+    EXPECT_EQ(sorted_entries, expected_entries) << thread_count << " threads";
+  }
+}
+
+TEST(ParallelSortRangeTest, ForEachRangeCoversAllItems) {
+  for (const auto item_count : {size_t{0}, size_t{10}, size_t{1'000'003}}) {
+    auto counts = std::vector<uint8_t>(item_count);
+    ParallelSort::for_each_range(item_count, [&](const size_t begin, const size_t end) {
+      for (auto item = begin; item < end; ++item) {
+        ++counts[item];
+      }
+    });
+    EXPECT_TRUE(std::all_of(counts.cbegin(), counts.cend(), [](const auto count) { return count == 1; }));
+  }
+}
+
+TEST(ParallelSortRangeTest, ForEachRangeWithRangeIdsCoversAllItems) {
+  const auto item_count = size_t{100'003};
+  auto range_ids = std::vector<size_t>(item_count);
+  ParallelSort::for_each_range(item_count, 4, [&](const size_t range_id, const size_t begin, const size_t end) {
+    for (auto item = begin; item < end; ++item) {
+      range_ids[item] = range_id + 1;
+    }
+  });
+  // the ranges are contiguous and in the order of their ids
+  EXPECT_TRUE(std::is_sorted(range_ids.cbegin(), range_ids.cend()));
+  EXPECT_EQ(range_ids.front(), 1);
+  EXPECT_EQ(range_ids.back(), 4);
+}
+
+}  // namespace imib
@@ -0,0 +1,93 @@
+#include <algorithm>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "utils/simd_search.hpp"
+
+namespace imib {
+
+template <typename Key>
+class SimdSearchTest : public ::testing::Test {
+ protected:
+  // the instruction sets of the CPU, the scalar fallback is always supported
+  static std::vector<SimdInstructionSet> _instruction_sets() {
+    auto instruction_sets = std::vector<SimdInstructionSet>{SimdInstructionSet::Scalar};
+    if (SimdSearch::supported_instruction_set() != SimdInstructionSet::Scalar) {
+      instruction_sets.push_back(SimdInstructionSet::AVX2);
+    }
+    if (SimdSearch::supported_instruction_set() == SimdInstructionSet::AVX512) {
+      instruction_sets.push_back(SimdInstructionSet::AVX512);
+    }
+    return instruction_sets;
+  }
+
+  // compares the search results with std::lower_bound and std::upper_bound
+  static void _expect_std_results(const std::vector<Key>& keys, const Key search_key) {
+    const auto expected_lower_bound =
+        static_cast<size_t>(std::lower_bound(keys.cbegin(), keys.cend(), search_key) - keys.cbegin());
+    const auto expected_upper_bound =
+        static_cast<size_t>(std::upper_bound(keys.cbegin(), keys.cend(), search_key) - keys.cbegin());
+    for (const auto instruction_set : _instruction_sets()) {
+      ASSERT_EQ(SimdSearch::lower_bound(keys.data(), keys.size(), search_key, instruction_set), expected_lower_bound);
+      ASSERT_EQ(SimdSearch::upper_bound(keys.data(), keys.size(), search_key, instruction_set), expected_upper_bound);
+    }
+  }
+};
+
+using SimdSearchTestingTypes = ::testing::Types<uint32_t, uint64_t>;
+TYPED_TEST_SUITE(SimdSearchTest, SimdSearchTestingTypes);
+
+TYPED_TEST(SimdSearchTest, EmptyKeys) {
+  const auto keys = std::vector<TypeParam>{};
+  this->_expect_std_results(keys, 0);
+  this->_expect_std_results(keys, 42);
+}
+
+// the sizes cover the k-ary search steps, the vectorized linear scan, and the scalar remainder
+TYPED_TEST(SimdSearchTest, RandomKeys) {
+  auto random_engine = std::mt19937_64{42};
+  for (size_t size = 1; size < 1000; size += 7) {
+    auto keys = std::vector<TypeParam>(size);
+    for (auto& key : keys) {
+      key = static_cast<TypeParam>(random_engine());
+    }
+    std::sort(keys.begin(), keys.end());
+    for (const auto& key : keys) {
+      this->_expect_std_results(keys, key);
+      this->_expect_std_results(keys, key + 1);
+      this->_expect_std_results(keys, key - 1);
+    }
+  }
+}
+
+TYPED_TEST(SimdSearchTest, KeyDuplicates) {
+  auto keys = std::vector<TypeParam>{};
+  for (TypeParam key = 1; key < 20; ++key) {
+    keys.insert(keys.end(), key * 3, key * 10);
+  }
+  for (TypeParam key = 0; key < 210; ++key) {
+    this->_expect_std_results(keys, key);
+  }
+}
+
+// AVX2 only compares signed integers, the keys with the most significant bit set must still be ordered correctly
+TYPED_TEST(SimdSearchTest, LargeKeys) {
+  constexpr auto MAX_KEY = std::numeric_limits<TypeParam>::max();
+  auto keys = std::vector<TypeParam>{};
+  for (TypeParam offset = 0; offset < 100; ++offset) {
+    keys.push_back(offset);
+    keys.push_back(MAX_KEY / 2 + offset);
+    keys.push_back(MAX_KEY - offset);
+  }
+  std::sort(keys.begin(), keys.end());
+  for (const auto& key : keys) {
+    this->_expect_std_results(keys, key);
+  }
+  this->_expect_std_results(keys, MAX_KEY / 4);
+  this->_expect_std_results(keys, MAX_KEY - 200);
+}
+
+}  // namespace imib